@@ -0,0 +1,96 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "daal/af/app_handler/details/fork_join_module_handler.hpp"
+#include "daal/af/app_handler/details/static_fork_join_handler.hpp"
+
+namespace {
+
+using daal::af::app_handler::ForkJoinModuleHandler;
+
+constexpr unsigned int kMaxWorkers{3};
+constexpr int kWorkerPriority{0};
+
+class NullModule : public daal::af::app_handler::IApplicationHandler {
+ public:
+  bool Initialize() override { return true; }
+  bool PrepareForExecute() override { return true; }
+  bool Execute() override { return true; }
+  bool PrepareForShutdown() override { return true; }
+  bool Shutdown() override { return true; }
+};
+
+/** Cores of the workers, one core is left for the calling thread. */
+std::vector<unsigned int> WorkerCores() {
+  const unsigned int kCores{std::max(std::thread::hardware_concurrency(), 2U)};
+  std::vector<unsigned int> cores;
+  for (unsigned int core = 1; core < kCores && cores.size() < kMaxWorkers; ++core) {
+    cores.push_back(core);
+  }
+  return cores;
+}
+
+}  // namespace
+
+/** Fork and join of independent no-op modules, the argument is the number of modules. */
+static void BM_ForkJoinExecute(benchmark::State &state) {
+  ForkJoinModuleHandler::ModuleGraph graph;
+  for (int64_t module = 0; module < state.range(0); ++module) {
+    graph.push_back({ForkJoinModuleHandler::TaskAffinity::ANY, std::make_shared<NullModule>()});
+  }
+  ForkJoinModuleHandler handler{WorkerCores(), kWorkerPriority, graph};
+  if (!handler.Initialize() || !handler.PrepareForExecute()) {
+    state.SkipWithError("Handler initialization failed");
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handler.Execute());
+  }
+  (void)handler.PrepareForShutdown();
+  (void)handler.Shutdown();
+}
+BENCHMARK(BM_ForkJoinExecute)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+/** Two stages with one main and one worker module, configured at runtime. */
+static void BM_ForkJoinTwoStages(benchmark::State &state) {
+  ForkJoinModuleHandler::StageList stages{
+      {{ForkJoinModuleHandler::TaskAffinity::MAIN, std::make_shared<NullModule>()},
+       {ForkJoinModuleHandler::TaskAffinity::WORKER, std::make_shared<NullModule>(), 0}},
+      {{ForkJoinModuleHandler::TaskAffinity::MAIN, std::make_shared<NullModule>()},
+       {ForkJoinModuleHandler::TaskAffinity::WORKER, std::make_shared<NullModule>(), 0}}};
+  ForkJoinModuleHandler handler{{WorkerCores().front()}, kWorkerPriority, stages};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handler.Execute());
+  }
+}
+BENCHMARK(BM_ForkJoinTwoStages)->UseRealTime();
+
+/** The same topology fixed at compile time. */
+static void BM_StaticForkJoinTwoStages(benchmark::State &state) {
+  using daal::af::app_handler::ForkJoinStage;
+  using daal::af::app_handler::MainModule;
+  using daal::af::app_handler::WorkerModule;
+  using Stage = ForkJoinStage<MainModule<NullModule>, WorkerModule<0, NullModule>>;
+  daal::af::app_handler::StaticForkJoinHandler<Stage, Stage> handler{{WorkerCores().front()}, kWorkerPriority};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handler.Execute());
+  }
+}
+BENCHMARK(BM_StaticForkJoinTwoStages)->UseRealTime();
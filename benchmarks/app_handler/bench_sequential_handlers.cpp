@@ -0,0 +1,66 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "daal/af/app_handler/details/sequential_list_handler.hpp"
+#include "daal/af/app_handler/details/static_sequential_handler.hpp"
+
+namespace {
+
+using daal::af::app_base::MethodState;
+
+/** Module with a tiny step, the handler overhead dominates. */
+class CounterModule final : public daal::af::app_base::SafeApplicationBase {
+ public:
+  MethodState OnInitialize() override { return MethodState::kSuccessful; }
+  MethodState OnStart() override { return MethodState::kSuccessful; }
+  MethodState Step() override {
+    ++counter_;
+    return MethodState::kSuccessful;
+  }
+  MethodState OnStop() override { return MethodState::kSuccessful; }
+  MethodState OnTerminate() override { return MethodState::kSuccessful; }
+
+ private:
+  std::uint64_t counter_{0};
+};
+
+}  // namespace
+
+/** Eight modules behind shared pointers, called virtually. */
+static void BM_SequentialListExecute(benchmark::State &state) {
+  daal::af::app_handler::SequentialListAppHandler::AppList apps;
+  for (int module = 0; module < 8; ++module) {
+    apps.push_back(std::make_shared<CounterModule>());
+  }
+  daal::af::app_handler::SequentialListAppHandler handler{apps};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handler.Execute());
+  }
+}
+BENCHMARK(BM_SequentialListExecute);
+
+/** The same eight modules stored by value and called directly. */
+static void BM_StaticSequentialExecute(benchmark::State &state) {
+  daal::af::app_handler::StaticSequentialHandler<CounterModule, CounterModule, CounterModule, CounterModule,
+                                                 CounterModule, CounterModule, CounterModule, CounterModule>
+      handler;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(handler.Execute());
+  }
+}
+BENCHMARK(BM_StaticSequentialExecute);
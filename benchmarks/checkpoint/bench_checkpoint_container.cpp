@@ -0,0 +1,127 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "daal/af/checkpoint/details/checkpoint_container.hpp"
+#include "daal/af/checkpoint/details/parallel_checkpoint_container.hpp"
+#include "daal/af/runtime_statistics/reporting_backend.hpp"
+#include "daal/af/runtime_statistics/time_provider.hpp"
+
+namespace {
+
+class NullCheckpoint : public daal::af::checkpoint::ICheckpoint {
+ public:
+  NullCheckpoint(std::string name, daal::af::checkpoint::When when) : name_{std::move(name)}, when_{when} {}
+  std::error_code Trigger() override { return {}; }
+  daal::af::checkpoint::When GetWhen() const override { return when_; }
+  std::string const &GetName() const override { return name_; }
+
+ private:
+  std::string name_;
+  daal::af::checkpoint::When when_;
+};
+
+/** A checkpoint of a final type, the frozen container triggers it without virtual dispatch. */
+class FinalCheckpoint final : public daal::af::checkpoint::ICheckpoint {
+ public:
+  explicit FinalCheckpoint(std::string name) : name_{std::move(name)} {}
+  std::error_code Trigger() override { return {}; }
+  daal::af::checkpoint::When GetWhen() const override { return daal::af::checkpoint::When::BEFORE; }
+  std::string const &GetName() const override { return name_; }
+
+ private:
+  std::string name_;
+};
+
+class NullBackend : public daal::af::runtime_statistics::IReportingBackend {
+ public:
+  void Show(const daal::af::runtime_statistics::RuntimeStatistics::Statistics &) noexcept override {}
+};
+
+}  // namespace
+
+/** Triggering the checkpoints of one point in the cycle, the argument is the number of checkpoints. */
+static void BM_TriggerCheckpoints(benchmark::State &state) {
+  daal::af::checkpoint::CheckpointContainer container;
+  for (int64_t idx = 0; idx < state.range(0); ++idx) {
+    (void)container.AddCheckpoint(
+        std::make_shared<NullCheckpoint>("checkpoint_" + std::to_string(idx), daal::af::checkpoint::When::BEFORE));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(container.TriggerCheckpoints(daal::af::checkpoint::When::BEFORE));
+  }
+}
+BENCHMARK(BM_TriggerCheckpoints)->RangeMultiplier(4)->Range(1, 256);
+
+/** The same checkpoints after freezing, added by their final type. */
+static void BM_TriggerCheckpointsFrozen(benchmark::State &state) {
+  daal::af::checkpoint::CheckpointContainer container;
+  for (int64_t idx = 0; idx < state.range(0); ++idx) {
+    (void)container.AddCheckpoint(std::make_shared<FinalCheckpoint>("checkpoint_" + std::to_string(idx)));
+  }
+  container.Freeze();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(container.TriggerCheckpoints(daal::af::checkpoint::When::BEFORE));
+  }
+}
+BENCHMARK(BM_TriggerCheckpointsFrozen)->RangeMultiplier(4)->Range(1, 256);
+
+/** The frozen checkpoints measured individually, each measurement reads both clocks twice. */
+static void BM_TriggerCheckpointsMeasured(benchmark::State &state) {
+  daal::af::checkpoint::CheckpointContainer container;
+  for (int64_t idx = 0; idx < state.range(0); ++idx) {
+    (void)container.AddCheckpoint(std::make_shared<FinalCheckpoint>("checkpoint_" + std::to_string(idx)));
+  }
+  container.Freeze();
+  container.EnableStatistics("bench", std::make_shared<daal::af::runtime_statistics::TimeProvider>(),
+                             std::make_shared<NullBackend>());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(container.TriggerCheckpoints(daal::af::checkpoint::When::BEFORE));
+  }
+}
+BENCHMARK(BM_TriggerCheckpointsMeasured)->RangeMultiplier(4)->Range(1, 64);
+
+/** Adding checkpoints including the duplicate check, the argument is the number of checkpoints. */
+static void BM_AddCheckpoints(benchmark::State &state) {
+  std::vector<std::shared_ptr<NullCheckpoint>> checkpoints;
+  for (int64_t idx = 0; idx < state.range(0); ++idx) {
+    checkpoints.push_back(
+        std::make_shared<NullCheckpoint>("checkpoint_" + std::to_string(idx), daal::af::checkpoint::When::BEFORE));
+  }
+  for (auto _ : state) {
+    daal::af::checkpoint::CheckpointContainer container;
+    for (const auto &checkpoint : checkpoints) {
+      benchmark::DoNotOptimize(container.AddCheckpoint(checkpoint));
+    }
+  }
+}
+BENCHMARK(BM_AddCheckpoints)->RangeMultiplier(4)->Range(16, 256);
+
+/** The same checkpoints as independent nodes on one worker and the calling thread. */
+static void BM_TriggerCheckpointsParallel(benchmark::State &state) {
+  daal::af::checkpoint::ParallelCheckpointContainer container{{1}, 0};
+  for (int64_t idx = 0; idx < state.range(0); ++idx) {
+    (void)container.AddCheckpoint(
+        std::make_shared<NullCheckpoint>("checkpoint_" + std::to_string(idx), daal::af::checkpoint::When::BEFORE));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(container.TriggerCheckpoints(daal::af::checkpoint::When::BEFORE));
+  }
+}
+BENCHMARK(BM_TriggerCheckpointsParallel)->RangeMultiplier(4)->Range(1, 256)->UseRealTime();
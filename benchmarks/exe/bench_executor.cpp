@@ -0,0 +1,76 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/checkpoint/details/null_checkpoint_container.hpp"
+#include "daal/af/env/execution_environment.hpp"
+#include "daal/af/exe/details/executor_impl.hpp"
+#include "daal/af/os/posix_helper.hpp"
+#include "daal/af/trigger/trigger.hpp"
+
+namespace {
+
+/** Environment running the executor loop once per benchmark iteration. */
+class BenchmarkEnvironment : public daal::af::env::ExecutionEnvironment {
+ public:
+  explicit BenchmarkEnvironment(benchmark::State &state) : state_{state} {}
+  bool Init() override { return true; }
+  bool Deinit() override { return true; }
+  void SetState(const State /*state*/) noexcept override {}
+  bool IsSigTerm() const noexcept override { return !state_.KeepRunning(); }
+  bool Refresh() const noexcept override { return true; }
+
+ private:
+  benchmark::State &state_;
+};
+
+class NullPosixHelper : public daal::af::os::IPosixHelper {
+ public:
+  bool IsNoEnvVarSet(char const * /*search_str*/, char const * /*ignore_str*/) override { return true; }
+  bool IsFpuWorking(float /*f_precision*/) override { return true; }
+  bool DropPrivileges() override { return true; }
+  void SetupOomHandler() override {}
+};
+
+/** Trigger that never waits, so only the framework overhead of a cycle is measured. */
+class ImmediateTrigger : public daal::af::trigger::Trigger {
+ public:
+  bool CheckTriggerConditionAndWait() override { return true; }
+};
+
+class NullApplicationHandler : public daal::af::app_handler::IApplicationHandler {
+ public:
+  bool Initialize() override { return true; }
+  bool PrepareForExecute() override { return true; }
+  bool Execute() override { return true; }
+  bool PrepareForShutdown() override { return true; }
+  bool Shutdown() override { return true; }
+};
+
+}  // namespace
+
+/** Overhead of one Executor::Run() cycle: trigger, checkpoints, runtime statistics and a no-op application. */
+static void BM_ExecutorCycle(benchmark::State &state) {
+  daal::af::exe::Executor executor{std::make_unique<BenchmarkEnvironment>(state), std::make_unique<NullPosixHelper>(),
+                                   std::make_unique<ImmediateTrigger>(),
+                                   std::make_unique<daal::af::checkpoint::NullCheckpointContainer>()};
+  executor.SetApplicationHandler(std::make_unique<NullApplicationHandler>());
+  if (!executor.Run()) {
+    state.SkipWithError("Executor::Run failed");
+  }
+}
+BENCHMARK(BM_ExecutorCycle);
@@ -0,0 +1,84 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "daal/log/logger.hpp"
+#include "daal/log/sink.hpp"
+
+namespace {
+
+using daal::log::LogLevel;
+
+/** Sink discarding all messages, so only the cost of the logger is measured. */
+class NullSink : public daal::log::Sink {
+ public:
+  explicit NullSink(bool is_deferred) : is_deferred_{is_deferred} {}
+
+  void ShowBuffer(LogLevel /*log_level*/, const daal::log::MessageBuffer &buffer) override {
+    benchmark::DoNotOptimize(buffer.data());
+  }
+
+  void ShowDeferred(LogLevel /*log_level*/, const daal::log::DeferredMessage &message) override {
+    benchmark::DoNotOptimize(message.args.data());
+  }
+
+  bool IsDeferred() const override { return is_deferred_; }
+
+  void Flush() override {}
+
+ private:
+  bool is_deferred_;
+};
+
+std::shared_ptr<daal::log::Logger> MakeLogger(bool is_deferred) {
+  auto logger = std::make_shared<daal::log::Logger>("BENCH");
+  auto sink = std::make_shared<NullSink>(is_deferred);
+  sink->SetLogLevel(LogLevel::kWarning);
+  (void)logger->AddSink(sink);
+  return logger;
+}
+
+}  // namespace
+
+/** Message shown on a sink, formatted on the calling thread. */
+static void BM_LoggerEnabled(benchmark::State &state) {
+  auto logger = MakeLogger(false);
+  int cycle{0};
+  for (auto _ : state) {
+    logger->Warning("cycle {} took {:.3f} ms on {}", ++cycle, 0.25, "core");
+  }
+}
+BENCHMARK(BM_LoggerEnabled);
+
+/** Message shown on a deferred sink, only the arguments are encoded on the calling thread. */
+static void BM_LoggerDeferred(benchmark::State &state) {
+  auto logger = MakeLogger(true);
+  int cycle{0};
+  for (auto _ : state) {
+    logger->Warning("cycle {} took {:.3f} ms on {}", ++cycle, 0.25, "core");
+  }
+}
+BENCHMARK(BM_LoggerDeferred);
+
+/** Message below the level of all sinks. */
+static void BM_LoggerFiltered(benchmark::State &state) {
+  auto logger = MakeLogger(false);
+  int cycle{0};
+  for (auto _ : state) {
+    logger->Info("cycle {} took {:.3f} ms on {}", ++cycle, 0.25, "core");
+  }
+}
+BENCHMARK(BM_LoggerFiltered);
@@ -0,0 +1,43 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "daal/af/runtime_statistics/reporting_backend.hpp"
+#include "daal/af/runtime_statistics/runtime_statistics.hpp"
+#include "daal/af/runtime_statistics/time_provider.hpp"
+
+namespace {
+
+using daal::af::runtime_statistics::RuntimeStatistics;
+
+class NullBackend : public daal::af::runtime_statistics::IReportingBackend {
+ public:
+  void Show(const RuntimeStatistics::Statistics & /*statistics*/) noexcept override {}
+};
+
+}  // namespace
+
+/** One measured cycle, the argument selects the mode: 0 basic, 1 histogram. */
+static void BM_RuntimeStatisticsMeasurement(benchmark::State &state) {
+  const auto kMode = state.range(0) == 0 ? RuntimeStatistics::Mode::kBasic : RuntimeStatistics::Mode::kHistogram;
+  RuntimeStatistics statistics{"bench", std::make_shared<daal::af::runtime_statistics::TimeProvider>(),
+                               std::make_shared<NullBackend>(), 0.0F, kMode};
+  for (auto _ : state) {
+    statistics.StartMeasurement();
+    statistics.StopMeasurement();
+  }
+}
+BENCHMARK(BM_RuntimeStatisticsMeasurement)->Arg(0)->Arg(1);
@@ -0,0 +1,56 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#include "daal/af/sync/triple_buffer.hpp"
+
+namespace {
+
+template <std::size_t kSize>
+using Sample = std::array<unsigned char, kSize>;
+
+}  // namespace
+
+/** Taking a sample into the step by copying it into a cache, as IoHandlers did in PrepareStep(). */
+template <std::size_t kSize>
+static void BM_SnapshotCopy(benchmark::State &state) {
+  Sample<kSize> received{};
+  Sample<kSize> cache{};
+  for (auto _ : state) {
+    std::memcpy(cache.data(), received.data(), kSize);
+    benchmark::DoNotOptimize(cache.data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK_TEMPLATE(BM_SnapshotCopy, 64);
+BENCHMARK_TEMPLATE(BM_SnapshotCopy, 4096);
+BENCHMARK_TEMPLATE(BM_SnapshotCopy, 65536);
+
+/** Publishing a sample written in place and taking it into the step, the size does not matter. */
+template <std::size_t kSize>
+static void BM_SnapshotTripleBuffer(benchmark::State &state) {
+  daal::af::sync::TripleBuffer<Sample<kSize>> buffer;
+  for (auto _ : state) {
+    buffer.Publish();
+    benchmark::DoNotOptimize(buffer.Consume());
+    benchmark::DoNotOptimize(&buffer.GetFront());
+  }
+}
+BENCHMARK_TEMPLATE(BM_SnapshotTripleBuffer, 64);
+BENCHMARK_TEMPLATE(BM_SnapshotTripleBuffer, 4096);
+BENCHMARK_TEMPLATE(BM_SnapshotTripleBuffer, 65536);
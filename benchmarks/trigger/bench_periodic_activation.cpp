@@ -0,0 +1,55 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "daal/af/trigger/details/trigger_activation_impl.hpp"
+#include "daal/af/trigger/wait_policy.hpp"
+
+namespace {
+
+constexpr std::chrono::microseconds kPeriod{500};
+
+}  // namespace
+
+/** Wake-up jitter of a 500 µs period per wait strategy, the argument selects the strategy. */
+static void BM_PeriodicActivationJitter(benchmark::State &state) {
+  const daal::af::trigger::WaitPolicy kPolicy{static_cast<daal::af::trigger::WaitStrategy>(state.range(0)),
+                                              std::chrono::microseconds{100}};
+  daal::af::trigger::PeriodicActivation activation{kPeriod, std::chrono::nanoseconds{0}, kPolicy};
+  // The first activation aligns to the time grid
+  (void)activation.Wait();
+
+  double jitter_sum{0.0};
+  double jitter_max{0.0};
+  std::uint64_t missed{0};
+  for (auto _ : state) {
+    missed += activation.Wait();
+    const double kJitter{std::chrono::duration<double, std::micro>(activation.GetWakeUpJitter()).count()};
+    jitter_sum += kJitter;
+    jitter_max = std::max(jitter_max, kJitter);
+  }
+  state.counters["jitter_mean_us"] = benchmark::Counter(jitter_sum, benchmark::Counter::kAvgIterations);
+  state.counters["jitter_max_us"] = jitter_max;
+  state.counters["missed_cycles"] = static_cast<double>(missed);
+}
+BENCHMARK(BM_PeriodicActivationJitter)
+    ->ArgName("strategy")
+    ->Arg(static_cast<int>(daal::af::trigger::WaitStrategy::kSleep))
+    ->Arg(static_cast<int>(daal::af::trigger::WaitStrategy::kSpin))
+    ->Arg(static_cast<int>(daal::af::trigger::WaitStrategy::kHybrid))
+    ->Iterations(2000)
+    ->UseRealTime();
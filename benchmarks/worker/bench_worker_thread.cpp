@@ -0,0 +1,52 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+#include "daal/af/sync/completion_latch.hpp"
+#include "daal/af/worker/worker_thread.hpp"
+
+namespace {
+
+constexpr unsigned int kWorkerCore{0};
+constexpr int kWorkerPriority{0};
+
+bool NoOp(void * /*context*/) { return true; }
+
+}  // namespace
+
+/** Round trip of a std::future based submission: hand over, execute and wait for the result. */
+static void BM_WorkerThreadSubmit(benchmark::State &state) {
+  daal::af::worker::WorkerThread worker{kWorkerCore, kWorkerPriority};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(worker.Submit(std::function<bool()>{[]() { return true; }}).get());
+  }
+}
+BENCHMARK(BM_WorkerThreadSubmit)->UseRealTime();
+
+/** Round trip of an allocation free submission through Post() and a CompletionLatch. */
+static void BM_WorkerThreadPost(benchmark::State &state) {
+  daal::af::worker::WorkerThread worker{kWorkerCore, kWorkerPriority};
+  daal::af::sync::CompletionLatch latch;
+  for (auto _ : state) {
+    latch.Reset(1);
+    if (!worker.Post(&NoOp, nullptr, &latch)) {
+      state.SkipWithError("Post failed");
+      break;
+    }
+    benchmark::DoNotOptimize(latch.Wait());
+  }
+}
+BENCHMARK(BM_WorkerThreadPost)->UseRealTime();
@@ -13,8 +13,6 @@
 
 #include "steering_wheel_server_score.hpp"
 
-#include <cstring>
-
 #include "score/mw/com/runtime.h"
 
 using namespace score::mw::log;
@@ -46,6 +44,16 @@ daal::af::app_base::IoHandler::ConnectionState SteeringWheelServerScore::Start()
   }
   proxy_ = std::move(proxy_result.value());
 
+  // Runs on the middleware thread: the newest request goes to the back buffer, the next step takes it over without
+  // a copy and publishing it wakes the executor instead of polling every period
+  proxy_->SteeringRequest.SetReceiveHandler([this]() {
+    const auto received = proxy_->SteeringRequest.GetNewSamples(
+        [this](auto recv) { GetInputBackBuffer() = *recv; }, 10);
+    if (received.has_value() && (received.value() > 0)) {
+      PublishInput();
+    }
+  });
+
   // Subscribe to hello messages
   proxy_->SteeringRequest.Subscribe(1);
 
@@ -56,22 +64,11 @@ daal::af::app_base::IoHandler::ConnectionState SteeringWheelServerScore::Start()
 void SteeringWheelServerScore::Stop() {
   // Unsubscribe and clean up proxy if it exists
   if (proxy_.has_value()) {
+    proxy_->SteeringRequest.UnsetReceiveHandler();
     proxy_->SteeringRequest.Unsubscribe();
     proxy_.reset();
   }
 }
 
-void SteeringWheelServerScore::PrepareStep() {
-  // TODO: check handle for connection state and set it to kDisconnected
-  proxy_->SteeringRequest.GetNewSamples(
-      [this](auto recv) {
-        const daal::examples::spec::SteeringRequest& msg = *recv;
-        std::memcpy(&cache_, &msg, sizeof(daal::examples::spec::SteeringRequest));
-      },
-      10);
-}
-
-const daal::examples::spec::SteeringRequest& SteeringWheelServerScore::GetSteeringRequest() const { return cache_; }
-
 }  // namespace examples
 }  // namespace daal
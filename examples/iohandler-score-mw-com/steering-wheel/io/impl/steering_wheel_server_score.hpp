@@ -29,15 +29,9 @@ class SteeringWheelServerScore : public SteeringWheelServer {
   ConnectionState Start() override;
   void Stop() override;
 
-  void PrepareStep() override;
-  void FinalizeStep() override {}
-
-  const daal::examples::spec::SteeringRequest& GetSteeringRequest() const override;
-
  private:
   score::cpp::optional<score::mw::com::InstanceSpecifier> instance_specifier_;
   score::cpp::optional<SteeringRequestProxy> proxy_;
-  spec::SteeringRequest cache_;  // TODO: really use zero-copy here, return reference to data
 };
 
 }  // namespace examples
@@ -16,18 +16,19 @@
 
 #include <cstdint>
 
-#include "daal/af/app_base/iohandler.hpp"
+#include "daal/af/app_base/buffered_iohandler.hpp"
 #include "spec/steering_request.hpp"
 
 namespace daal {
 namespace examples {
 
-class SteeringWheelServer : public daal::af::app_base::IoHandler {
+class SteeringWheelServer : public daal::af::app_base::BufferedIoHandler<daal::examples::spec::SteeringRequest> {
  public:
   SteeringWheelServer() = default;
   ~SteeringWheelServer() = default;
 
-  virtual const daal::examples::spec::SteeringRequest& GetSteeringRequest() const = 0;
+  // Latest request received before the step, stable for the whole step
+  const daal::examples::spec::SteeringRequest& GetSteeringRequest() const { return GetInput(); }
 };
 
 }  // namespace examples
@@ -20,7 +20,8 @@
 #include "daal/af/exe/builder/executor_builder.hpp"
 #include "daal/af/os/details/posix_helper_impl.hpp"
 #include "daal/af/score/score_exec_env.hpp"
-#include "daal/af/trigger/details/trigger_impl.hpp"
+#include "daal/af/sync/data_ready_signal.hpp"
+#include "daal/af/trigger/details/event_trigger.hpp"
 
 // the actual application
 #include "steering_wheel_app.hpp"
@@ -34,8 +35,10 @@ int main() {
   auto logger = std::make_shared<daal::log::Logger>("STEERING_WHEEL_APP");
   logger->AddDefaultSinks();
 
-  // IO handlers
+  // IO handlers, new steering requests trigger the cycle
+  daal::af::sync::DataReadySignal data_ready{};
   daal::examples::SteeringWheelServerScore score_mw_com_server{};
+  score_mw_com_server.SetDataReadySignal(&data_ready);
   daal::examples::SteeringWheelIoContainer io_container{score_mw_com_server};
 
   // application and app handler
@@ -47,7 +50,7 @@ int main() {
                  .SetExecutionEnvironment(std::make_unique<daal::af::score::ScoreExecutionEnvironment>(
                      "examples/iohandler-score-mw-com/etc/mw_com_config.json"))
                  .SetPosixHelper(std::make_unique<daal::af::os::PosixHelper>())
-                 .SetTrigger(std::make_unique<daal::af::trigger::PeriodicTrigger>(500ms))
+                 .SetTrigger(std::make_unique<daal::af::trigger::EventTrigger>(data_ready, 500ms))
                  .SetCheckpointContainer(std::make_unique<daal::af::checkpoint::CheckpointContainer>())
                  .Start()
                  .End()
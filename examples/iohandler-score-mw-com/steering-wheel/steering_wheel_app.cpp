@@ -33,7 +33,7 @@ daal::af::app_base::MethodState SteeringWheelApp::Step(daal::examples::SteeringW
 
   if (io.SteeringWheelServer().GetConnectionState() == daal::af::app_base::IoHandler::ConnectionState::kConnected) {
     logger_->Info("SteeringWheelServer not connected, skipping step.");
-    auto request = io.SteeringWheelServer().GetSteeringRequest();
+    const auto &request = io.SteeringWheelServer().GetSteeringRequest();
     logger_->Info(
         "Received Steering Request - Angle: {}, Angle Mode: {}, Torque Offset: {}, Torque Offset Mode: {}, Torque: {}, "
         "Torque Mode: {}",
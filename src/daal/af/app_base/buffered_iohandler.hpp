@@ -0,0 +1,98 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_APP_BASE_BUFFERED_IOHANDLER_HPP
+#define SRC_DAAL_AF_APP_BASE_BUFFERED_IOHANDLER_HPP
+
+#include "daal/af/app_base/iohandler.hpp"
+#include "daal/af/sync/triple_buffer.hpp"
+
+namespace daal {
+namespace af {
+
+namespace app_base {
+
+/* output type of handlers that only receive */
+struct NoOutput {};
+
+/* IoHandler exchanging its data with the application through triple buffers
+ * instead of copies.
+ *
+ * Inputs: the communication callback writes a new sample into
+ * GetInputBackBuffer() and calls PublishInput(), which also announces the
+ * sample through the data ready signal. PrepareStep() takes the latest
+ * published sample as snapshot, GetInput() refers to it without a copy and
+ * stays stable for the whole step even if new samples arrive meanwhile.
+ *
+ * Outputs: the application writes its output into GetOutput() during the step,
+ * FinalizeStep() publishes it. The sending side takes the latest output with
+ * ConsumeOutput() and reads it through GetPublishedOutput(), e.g. from a
+ * middleware thread.
+ *
+ * Taking a snapshot costs two atomic exchanges regardless of the size of the
+ * data, samples of a few cache lines are as cheap to copy; the buffers pay off
+ * for larger samples and whenever the data is written by another thread.
+ *
+ * Implementations overriding PrepareStep() or FinalizeStep() have to call the
+ * versions of this class. */
+template <typename Input, typename Output = NoOutput>
+class BufferedIoHandler : public IoHandler {
+ public:
+  using InputType = Input;
+  using OutputType = Output;
+
+  /* takes the latest published input as snapshot of the step */
+  void PrepareStep() override { has_new_input_ = input_.Consume(); }
+
+  /* publishes the output written during the step */
+  void FinalizeStep() override { output_.Publish(); }
+
+  /* snapshot of the current step, a default constructed Input until the first
+   * sample arrived */
+  const Input &GetInput() const noexcept { return input_.GetFront(); }
+
+  /* the snapshot was published since the previous step */
+  bool HasNewInput() const noexcept { return has_new_input_; }
+
+  /* output of the current step, holds an older output and has to be written
+   * completely every step */
+  Output &GetOutput() noexcept { return output_.GetBack(); }
+
+ protected:
+  /* buffer for the next input sample, to be written by one thread at a time */
+  Input &GetInputBackBuffer() noexcept { return input_.GetBack(); }
+
+  /* publishes the input sample written to GetInputBackBuffer() */
+  void PublishInput() noexcept {
+    input_.Publish();
+    NotifyDataReady();
+  }
+
+  /* takes the latest output published by FinalizeStep(), returns false if
+   * there is none since the previous call */
+  bool ConsumeOutput() noexcept { return output_.Consume(); }
+
+  /* output taken by the last ConsumeOutput() */
+  const Output &GetPublishedOutput() const noexcept { return output_.GetFront(); }
+
+ private:
+  daal::af::sync::TripleBuffer<Input> input_{};
+  daal::af::sync::TripleBuffer<Output> output_{};
+  bool has_new_input_{false};
+};
+
+}  // namespace app_base
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_APP_BASE_BUFFERED_IOHANDLER_HPP
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "daal/af/app_base/safe_application_base.hpp"
+#include "daal/af/sync/data_ready_signal.hpp"
 
 namespace daal {
 namespace af {
@@ -41,11 +42,25 @@ class IoHandler {
   /* returns the connection status of the IoHandler */
   ConnectionState GetConnectionState() const { return connection_state_; }
 
+  /* connects the handler to an event driven trigger, new data is announced
+   * through the signal instead of being polled every period; nullptr detaches
+   * the handler again. Must not be changed while the handler is receiving. */
+  void SetDataReadySignal(daal::af::sync::DataReadySignal *signal) { data_ready_signal_ = signal; }
+
  protected:
   void SetConnectionState(ConnectionState state) { connection_state_ = state; }
 
+  /* to be called by implementations whenever new data arrived, may be called
+   * from any thread, e.g. a middleware receive callback */
+  void NotifyDataReady() noexcept {
+    if (nullptr != data_ready_signal_) {
+      data_ready_signal_->Notify();
+    }
+  }
+
  private:
   ConnectionState connection_state_ = ConnectionState::kDisconnected;
+  daal::af::sync::DataReadySignal *data_ready_signal_ = nullptr;
 };
 
 using IoHandlerWrapper = std::reference_wrapper<IoHandler>;
@@ -14,7 +14,6 @@
 #include "fork_join_module_handler.hpp"
 
 #include <cstdlib>
-#include <future>
 
 #include "daal/log/framework_logger.hpp"
 
@@ -25,104 +24,156 @@ namespace af {
 namespace app_handler {
 
 ForkJoinModuleHandler::ForkJoinModuleHandler(unsigned int core_id, int priority, ForkMap fork_map)
+    : ForkJoinModuleHandler(std::vector<unsigned int>{core_id}, priority, std::move(fork_map)) {}
+
+ForkJoinModuleHandler::ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                                             ForkMap fork_map)
+    : ForkJoinModuleHandler(core_ids, priority, ToStageList(std::move(fork_map))) {}
+
+ForkJoinModuleHandler::ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                                             const StageList &stages)
+    : ForkJoinModuleHandler(core_ids, priority, FromStages(stages)) {}
+
+ForkJoinModuleHandler::ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                                             const ModuleGraph &module_graph)
     : IApplicationHandler(),
-      fork_map_(std::move(fork_map)),
-      worker_thread_{core_id, priority} {}
+      modules_{},
+      graph_modules_{},
+      shed_levels_{},
+      degradation_level_{0},
+      module_statistics_{},
+      worker_pool_{core_ids, priority},
+      task_graph_{core_ids.size()} {
+  // assign the modules to the main thread and the workers once
+  for (const auto &module_config : module_graph) {
+    const std::size_t kModule{graph_modules_.size()};
+    graph_modules_.push_back(module_config.application);
+    shed_levels_.push_back(module_config.shed_level);
+    auto task = [this, kModule]() -> bool { return ExecuteModule(kModule); };
+    switch (module_config.affinity) {
+      case TaskAffinity::MAIN:
+        task_graph_.AddNode(task, daal::af::worker::TaskGraph::kMainThread);
+        break;
+      case TaskAffinity::WORKER:
+        if (module_config.worker >= worker_pool_.Size()) {
+          daal::log::FrameworkLogger::get()->Error("Invalid worker index {}", module_config.worker);
+          exit(42);
+        }
+        task_graph_.AddNode(task, module_config.worker);
+        break;
+      case TaskAffinity::ANY:
+        task_graph_.AddNode(task);
+        break;
+      default:
+        daal::log::FrameworkLogger::get()->Error("Invalid thread affinity");
+        exit(42);
+    }
+  }
+  for (std::size_t module = 0; module < module_graph.size(); ++module) {
+    for (const auto dependency : module_graph[module].depends_on) {
+      if (!task_graph_.AddDependency(static_cast<daal::af::worker::TaskGraph::NodeId>(dependency),
+                                     static_cast<daal::af::worker::TaskGraph::NodeId>(module))) {
+        daal::log::FrameworkLogger::get()->Error("Invalid dependency of module {} on module {}", module, dependency);
+        exit(42);
+      }
+    }
+  }
+  if (!task_graph_.Finalize()) {
+    daal::log::FrameworkLogger::get()->Error("Invalid module graph");
+    exit(42);
+  }
+  for (const auto node : task_graph_.TopologicalOrder()) {
+    modules_.push_back(module_graph[node].application);
+  }
+}
+
+ForkJoinModuleHandler::StageList ForkJoinModuleHandler::ToStageList(ForkMap fork_map) {
+  StageList stages;
+  for (auto &pair : fork_map) {
+    stages.push_back(std::move(pair.second));
+  }
+  return stages;
+}
+
+ForkJoinModuleHandler::ModuleGraph ForkJoinModuleHandler::FromStages(const StageList &stages) {
+  ModuleGraph module_graph;
+  std::vector<std::size_t> previous_stage;
+  for (const auto &stage : stages) {
+    std::vector<std::size_t> current_stage;
+    for (const auto &phase_config : stage) {
+      current_stage.push_back(module_graph.size());
+      module_graph.push_back({phase_config.affinity, phase_config.application, phase_config.worker, previous_stage,
+                              phase_config.shed_level});
+    }
+    if (!current_stage.empty()) {
+      previous_stage = std::move(current_stage);
+    }
+  }
+  return module_graph;
+}
 
 bool ForkJoinModuleHandler::Initialize() {
   bool success = true;
-  for (auto &pair : fork_map_) {
-    for (auto &phases : pair.second) {
-      success = phases.second->Initialize() && success;
-    }
+  for (auto &module : modules_) {
+    success = module->Initialize() && success;
   }
   return success;
 }
 
 bool ForkJoinModuleHandler::PrepareForExecute() {
   bool success = true;
-  for (auto &pair : fork_map_) {
-    for (auto &phases : pair.second) {
-      success = phases.second->PrepareForExecute() && success;
-    }
+  for (auto &module : modules_) {
+    success = module->PrepareForExecute() && success;
   }
   return success;
 }
 
-bool ForkJoinModuleHandler::Execute() {
-  bool main_thread_success = true;
-  bool worker_thread_success = false;
-  // stage loop
-  for (auto &pair : fork_map_) {
-    auto &phase_configs = pair.second;
-
-    // Prepare the tasks for the main and worker threads
-    daal::af::worker::WorkerThread::TaskList main_t_tasks;
-    daal::af::worker::WorkerThread::TaskList worker_t_tasks;
-    // phase loop, assign the tasks to the main and worker threads
-    for (auto &phase_config : phase_configs) {
-      auto &thread_affinity = phase_config.first;
-      auto &application = phase_config.second;
-      auto lambda_func = [application]() -> bool { return application->Execute(); };
-      if (thread_affinity == TaskAffinity::MAIN) {
-        main_t_tasks.push(lambda_func);
-      } else if (thread_affinity == TaskAffinity::WORKER) {
-        worker_t_tasks.push(lambda_func);
-      } else {
-        daal::log::FrameworkLogger::get()->Error("Invalid thread affinity");
-        exit(42);
-      }
-    }
-
-    ///////////////////////// Fork Worker Thread///////////////////////////////
-    daal::log::FrameworkLogger::get()->Error("Worker thread load {}", worker_t_tasks.size());
-    std::future<bool> worker_future = worker_thread_.Submit(worker_t_tasks);
-    /////////////////////////////////////////////////////////////////////
+bool ForkJoinModuleHandler::Execute() { return task_graph_.Execute(worker_pool_); }
 
-    /////////////////////////Main Thread/////////////////////////////////
-    while (!main_t_tasks.empty()) {
-      auto &application_execution = main_t_tasks.front();
-      main_thread_success = application_execution() && main_thread_success;
-      main_t_tasks.pop();
-    }
-    ////////////////////////////////////////////////////////////////////
-
-    //////// Join Worker Thread ////////////////////////////////////////
-    daal::log::FrameworkLogger::get()->Error("Waiting for worker thread");
-    if (worker_future.valid()) {
-      worker_thread_success = worker_future.get();
-    } else {
-      // This is a catastrofic failuer as given future is not valid
-      daal::log::FrameworkLogger::get()->Error("Invalid future!");
-      exit(-1);
-    }
-    daal::log::FrameworkLogger::get()->Error("Waiting for worker thread done");
-    ////////////////////////////////////////////////////////////////////
+bool ForkJoinModuleHandler::ExecuteModule(std::size_t module) {
+  // the level is only changed between executions, forking the graph publishes it to the workers
+  if (shed_levels_[module] != 0U && degradation_level_ >= shed_levels_[module]) {
+    return true;
   }
-  bool final_result{worker_thread_success && main_thread_success};
-  return final_result;
+  const auto &application = graph_modules_[module];
+  return module_statistics_.Measure(module, [&application]() { return application->Execute(); });
 }
 
 bool ForkJoinModuleHandler::PrepareForShutdown() {
   bool success = true;
-  for (auto &pair : fork_map_) {
-    for (auto &phases : pair.second) {
-      success = phases.second->PrepareForShutdown() && success;
-    }
+  for (auto &module : modules_) {
+    success = module->PrepareForShutdown() && success;
   }
   return success;
 }
 
 bool ForkJoinModuleHandler::Shutdown() {
   bool success = true;
-  for (auto &pair : fork_map_) {
-    for (auto &phases : pair.second) {
-      success = phases.second->Shutdown() && success;
-    }
+  for (auto &module : modules_) {
+    success = module->Shutdown() && success;
   }
   return success;
 }
 
+bool ForkJoinModuleHandler::SetDegradationLevel(std::uint32_t level) {
+  degradation_level_ = level;
+  return true;
+}
+
+std::uint32_t ForkJoinModuleHandler::GetDegradationLevel() const noexcept { return degradation_level_; }
+
+void ForkJoinModuleHandler::EnableModuleStatistics(
+    const std::string &name, const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+    const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend, float startup_wait_time,
+    daal::af::runtime_statistics::RuntimeStatistics::Mode mode) {
+  module_statistics_.Enable(name, graph_modules_.size(), time_provider, backend, startup_wait_time, mode);
+}
+
+daal::af::runtime_statistics::ModuleStatistics &
+ForkJoinModuleHandler::GetModuleStatistics() noexcept {
+  return module_statistics_;
+}
+
 }  // namespace app_handler
 
 }  // namespace af
@@ -14,15 +14,18 @@
 #ifndef SRC_DAAL_AF_APP_HANDLER_DETAILS_FORK_JOIN_MODULE_HANDLER_HPP
 #define SRC_DAAL_AF_APP_HANDLER_DETAILS_FORK_JOIN_MODULE_HANDLER_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
-#include <queue>
-#include <unordered_map>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "daal/af/app_handler/iapplication_handler.hpp"
-#include "daal/af/worker/worker_thread.hpp"
-#include "utility"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
+#include "daal/af/worker/task_graph.hpp"
+#include "daal/af/worker/worker_pool.hpp"
 
 namespace daal {
 
@@ -33,15 +36,99 @@ namespace app_handler {
 /**
  * \brief The ForkJoinModuleHandler class is responsible for joint-fork module,
  * where it registers the modules to a stage and executes the stages
+ *
+ * The modules are nodes of a graph that is validated once at construction and
+ * executed on a pool of pinned worker threads and the main thread. Modules
+ * with affinity MAIN run on the main thread, modules with affinity WORKER run
+ * on the worker given in their config and modules with affinity ANY are
+ * balanced over all workers.
+ *
+ * The graph is given either as stages (ForkMap or StageList), which run in
+ * ascending order with a barrier in between, or as a ModuleGraph with explicit
+ * dependencies between modules. A module starts as soon as the modules it
+ * depends on finished, so independent branches do not wait for each other.
+ * Invalid dependencies and cycles terminate the process at construction.
+ *
+ * Modules with a shed level are optional: while the degradation level set by
+ * the executor is at least their shed level they are skipped and report
+ * success, so their dependents still run. Level 1 thus drops all modules
+ * marked optional, higher levels drop modules of lower priority as well.
  */
 class ForkJoinModuleHandler : public IApplicationHandler {
  public:
-  enum class TaskAffinity { MAIN, WORKER };
+  enum class TaskAffinity { MAIN, WORKER, ANY };
   enum class Stage { STAGE1, STAGE2, STAGE3 };
 
-  using PhaseConfig = std::pair<TaskAffinity, std::shared_ptr<IApplicationHandler>>;
+  /**
+   * \brief Configuration of a single module of a stage.
+   */
+  struct PhaseConfig {
+    TaskAffinity affinity;                             ///< Thread the module shall run on.
+    std::shared_ptr<IApplicationHandler> application;  ///< The module.
+    std::size_t worker{0};                             ///< Index of the worker if affinity is WORKER.
+    std::uint32_t shed_level{0};                       ///< Degradation level skipping the module, 0 never.
+  };
   using PhaseConfigList = std::vector<PhaseConfig>;
-  using ForkMap = std::unordered_map<Stage, PhaseConfigList>;
+  using ForkMap = std::map<Stage, PhaseConfigList>;
+  using StageList = std::vector<PhaseConfigList>;
+
+  /**
+   * \brief Configuration of a module with explicit dependencies.
+   */
+  struct ModuleConfig {
+    TaskAffinity affinity;                             ///< Thread the module shall run on.
+    std::shared_ptr<IApplicationHandler> application;  ///< The module.
+    std::size_t worker{0};                             ///< Index of the worker if affinity is WORKER.
+    std::vector<std::size_t> depends_on{};             ///< Indices of the modules to finish before.
+    std::uint32_t shed_level{0};                       ///< Degradation level skipping the module, 0 never.
+  };
+  using ModuleGraph = std::vector<ModuleConfig>;
+
+  /**
+   * \brief Converts stages to a module graph, every module of a stage depends on
+   * all modules of the previous non-empty stage.
+   */
+  static ModuleGraph FromStages(const StageList &stages);
+
+  /**
+   * \brief Construct a new Fork Join Module Handler object with a single worker
+   * \param core_id core the worker thread is affined to
+   * \param priority priority of the worker thread
+   * \param fork_map modules per stage
+   */
+  ForkJoinModuleHandler(unsigned int core_id, int priority, ForkMap fork_map);
+
+  /**
+   * \brief Construct a new Fork Join Module Handler object with one worker per
+   * given core
+   * \param core_ids cores the worker threads are affined to
+   * \param priority priority of the worker threads
+   * \param fork_map modules per stage
+   */
+  ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority, ForkMap fork_map);
+
+  /**
+   * \brief Construct a new Fork Join Module Handler object with one worker per
+   * given core and an arbitrary number of stages
+   * \param core_ids cores the worker threads are affined to
+   * \param priority priority of the worker threads
+   * \param stages modules per stage, in execution order
+   */
+  ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority, const StageList &stages);
+
+  /**
+   * \brief Construct a new Fork Join Module Handler object with one worker per
+   * given core and explicit dependencies between the modules
+   * \param core_ids cores the worker threads are affined to
+   * \param priority priority of the worker threads
+   * \param module_graph modules and their dependencies
+   */
+  ForkJoinModuleHandler(const std::vector<unsigned int> &core_ids, int priority, const ModuleGraph &module_graph);
+
+  /**
+   * \brief Default destructor.
+   */
+  ~ForkJoinModuleHandler() override = default;
 
   /**
    * \brief Initializes the application.
@@ -74,6 +161,40 @@ class ForkJoinModuleHandler : public IApplicationHandler {
    */
   bool Shutdown() override;
 
+  /**
+   * \brief Skips the modules whose shed level is between 1 and level from the
+   * next execution on.
+   *
+   * \return Always true, levels above the highest shed level skip all
+   * optional modules.
+   */
+  bool SetDegradationLevel(std::uint32_t level) override;
+
+  /**
+   * \brief Returns the current degradation level.
+   */
+  std::uint32_t GetDegradationLevel() const noexcept;
+
+  /**
+   * \brief Enables runtime statistics of every module, named "<name>.<module index>", the index
+   * of a module is its position in the module graph (or in the flattened stages).
+   * The statistics skip the given startup wait time [µs] and collect the given mode like
+   * RuntimeStatistics.
+   * \attention Must not be called while the handler executes.
+   */
+  void EnableModuleStatistics(const std::string &name,
+                              const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+                              const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend,
+                              float startup_wait_time =
+                                  daal::af::runtime_statistics::RuntimeStatistics::kStartupWaitTimeDefault,
+                              daal::af::runtime_statistics::RuntimeStatistics::Mode mode =
+                                  daal::af::runtime_statistics::RuntimeStatistics::Mode::kHistogram);
+
+  /**
+   * \brief Returns the runtime statistics of the modules.
+   */
+  daal::af::runtime_statistics::ModuleStatistics &GetModuleStatistics() noexcept;
+
  protected:
   /**
    * \brief Deleted default constructor.
@@ -95,20 +216,24 @@ class ForkJoinModuleHandler : public IApplicationHandler {
    */
   ForkJoinModuleHandler &operator=(ForkJoinModuleHandler &&) & = delete;
 
+ private:
   /**
-   * \brief Construct a new Simple Application Handler object
-   * \param application reference to the application to be handled
+   * \brief Converts the ordered stages of a fork map to a stage list.
    */
-  ForkJoinModuleHandler(unsigned int, int, ForkMap);
+  static StageList ToStageList(ForkMap fork_map);
 
   /**
-   * \brief Default destructor.
+   * \brief Executes a module of the graph and measures it if enabled.
    */
-  ~ForkJoinModuleHandler() override = default;
-
- private:
-  ForkMap fork_map_;
-  daal::af::worker::WorkerThread worker_thread_;
+  bool ExecuteModule(std::size_t module);
+
+  std::vector<std::shared_ptr<IApplicationHandler>> modules_;  ///< In topological order.
+  std::vector<std::shared_ptr<IApplicationHandler>> graph_modules_;  ///< In module graph order.
+  std::vector<std::uint32_t> shed_levels_;                           ///< In module graph order.
+  std::uint32_t degradation_level_;
+  daal::af::runtime_statistics::ModuleStatistics module_statistics_;
+  daal::af::worker::WorkerPool worker_pool_;
+  daal::af::worker::TaskGraph task_graph_;
 };
 
 }  // namespace app_handler
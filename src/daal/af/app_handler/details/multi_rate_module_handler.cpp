@@ -0,0 +1,200 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "multi_rate_module_handler.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <numeric>
+#include <utility>
+
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace app_handler {
+
+MultiRateModuleHandler::MultiRateModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                                               const RateConfigList &modules)
+    : IApplicationHandler(),
+      modules_{},
+      base_period_{0},
+      hyperperiod_{0},
+      module_statistics_{},
+      worker_pool_{core_ids, priority},
+      due_sets_{},
+      graphs_{},
+      tick_due_sets_{},
+      tick_{0} {
+  ComputeTiming(modules);
+  for (const auto &module_config : modules) {
+    modules_.push_back(module_config.application);
+  }
+
+  // Rate-monotonic order, modules of equal period keep their configuration order
+  std::vector<std::size_t> rate_order(modules.size());
+  std::iota(rate_order.begin(), rate_order.end(), 0U);
+  std::stable_sort(rate_order.begin(), rate_order.end(), [&modules](std::size_t lhs, std::size_t rhs) {
+    return modules[lhs].period < modules[rhs].period;
+  });
+
+  // One task graph per distinct set of due modules, the table refers to them by index
+  const auto kTicks = static_cast<std::size_t>(hyperperiod_ / base_period_);
+  std::map<std::vector<std::size_t>, std::uint32_t> due_set_index;
+  tick_due_sets_.reserve(kTicks);
+  for (std::size_t tick = 0; tick < kTicks; ++tick) {
+    const auto kTime = base_period_ * static_cast<std::int64_t>(tick);
+    std::vector<std::size_t> due;
+    for (const auto module : rate_order) {
+      if (kTime % modules[module].period == modules[module].offset) {
+        due.push_back(module);
+      }
+    }
+    const auto kInserted = due_set_index.emplace(due, static_cast<std::uint32_t>(due_sets_.size()));
+    if (kInserted.second) {
+      graphs_.push_back(BuildGraph(modules, due));
+      due_sets_.push_back(std::move(due));
+    }
+    tick_due_sets_.push_back(kInserted.first->second);
+  }
+}
+
+void MultiRateModuleHandler::ComputeTiming(const RateConfigList &modules) {
+  if (modules.empty()) {
+    daal::log::FrameworkLogger::get()->Error("Multi rate handler without modules");
+    exit(42);
+  }
+  std::int64_t base{0};
+  std::int64_t hyper{1};
+  for (std::size_t module = 0; module < modules.size(); ++module) {
+    const std::int64_t kPeriod{modules[module].period.count()};
+    const std::int64_t kOffset{modules[module].offset.count()};
+    if (kPeriod <= 0 || kOffset < 0 || kOffset >= kPeriod) {
+      daal::log::FrameworkLogger::get()->Error("Invalid period {} us or offset {} us of module {}", kPeriod, kOffset,
+                                               module);
+      exit(42);
+    }
+    base = std::gcd(std::gcd(base, kPeriod), kOffset);
+    hyper = hyper / std::gcd(hyper, kPeriod) * kPeriod;
+    if (hyper / base > static_cast<std::int64_t>(kMaxTicksPerHyperperiod)) {
+      daal::log::FrameworkLogger::get()->Error("Hyperperiod {} us exceeds {} ticks of {} us", hyper,
+                                               kMaxTicksPerHyperperiod, base);
+      exit(42);
+    }
+  }
+  base_period_ = std::chrono::microseconds{base};
+  hyperperiod_ = std::chrono::microseconds{hyper};
+}
+
+daal::af::worker::TaskGraph MultiRateModuleHandler::BuildGraph(const RateConfigList &modules,
+                                                               const std::vector<std::size_t> &due) {
+  daal::af::worker::TaskGraph graph{worker_pool_.Size()};
+  for (const auto module : due) {
+    auto task = [this, module]() -> bool { return ExecuteModule(module); };
+    switch (modules[module].affinity) {
+      case TaskAffinity::MAIN:
+        graph.AddNode(task, daal::af::worker::TaskGraph::kMainThread);
+        break;
+      case TaskAffinity::WORKER:
+        if (modules[module].worker >= worker_pool_.Size()) {
+          daal::log::FrameworkLogger::get()->Error("Invalid worker index {}", modules[module].worker);
+          exit(42);
+        }
+        graph.AddNode(task, modules[module].worker);
+        break;
+      case TaskAffinity::ANY:
+        graph.AddNode(task);
+        break;
+      default:
+        daal::log::FrameworkLogger::get()->Error("Invalid thread affinity");
+        exit(42);
+    }
+  }
+  if (!graph.Finalize()) {
+    daal::log::FrameworkLogger::get()->Error("Invalid multi rate schedule");
+    exit(42);
+  }
+  return graph;
+}
+
+bool MultiRateModuleHandler::Initialize() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->Initialize() && success;
+  }
+  return success;
+}
+
+bool MultiRateModuleHandler::PrepareForExecute() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->PrepareForExecute() && success;
+  }
+  tick_ = 0;
+  return success;
+}
+
+bool MultiRateModuleHandler::Execute() {
+  auto &graph = graphs_[tick_due_sets_[tick_]];
+  tick_ = (tick_ + 1 == tick_due_sets_.size()) ? 0 : tick_ + 1;
+  return graph.Execute(worker_pool_);
+}
+
+bool MultiRateModuleHandler::ExecuteModule(std::size_t module) {
+  const auto &application = modules_[module];
+  return module_statistics_.Measure(module, [&application]() { return application->Execute(); });
+}
+
+bool MultiRateModuleHandler::PrepareForShutdown() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->PrepareForShutdown() && success;
+  }
+  return success;
+}
+
+bool MultiRateModuleHandler::Shutdown() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->Shutdown() && success;
+  }
+  return success;
+}
+
+std::chrono::microseconds MultiRateModuleHandler::GetBasePeriod() const noexcept { return base_period_; }
+
+std::chrono::microseconds MultiRateModuleHandler::GetHyperperiod() const noexcept { return hyperperiod_; }
+
+const std::vector<std::size_t> &MultiRateModuleHandler::GetDueModules(std::size_t tick) const noexcept {
+  return due_sets_[tick_due_sets_[tick % tick_due_sets_.size()]];
+}
+
+void MultiRateModuleHandler::EnableModuleStatistics(
+    const std::string &name, const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+    const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend, float startup_wait_time,
+    daal::af::runtime_statistics::RuntimeStatistics::Mode mode) {
+  module_statistics_.Enable(name, modules_.size(), time_provider, backend, startup_wait_time, mode);
+}
+
+daal::af::runtime_statistics::ModuleStatistics &MultiRateModuleHandler::GetModuleStatistics() noexcept {
+  return module_statistics_;
+}
+
+}  // namespace app_handler
+
+}  // namespace af
+
+}  // namespace daal
@@ -0,0 +1,198 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_APP_HANDLER_DETAILS_MULTI_RATE_MODULE_HANDLER_HPP
+#define SRC_DAAL_AF_APP_HANDLER_DETAILS_MULTI_RATE_MODULE_HANDLER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
+#include "daal/af/worker/task_graph.hpp"
+#include "daal/af/worker/worker_pool.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace app_handler {
+
+/**
+ * \brief The MultiRateModuleHandler class runs modules of different periods
+ * inside one executor.
+ *
+ * Every module is registered with a period and an offset. The executor
+ * triggers the handler with the base period, the greatest common divisor of
+ * all periods and offsets. At construction the handler computes a table over
+ * the hyperperiod, the least common multiple of all periods, that holds the
+ * modules due in each tick. Execute() runs the modules of the current tick
+ * only and advances to the next one.
+ *
+ * The modules due in a tick are executed like a ForkJoinModuleHandler without
+ * dependencies: modules with affinity MAIN run on the main thread, modules
+ * with affinity WORKER on the given worker and modules with affinity ANY are
+ * balanced over the workers. Modules are dispatched rate-monotonic: the
+ * shorter the period, the earlier a module starts on its thread. All modules
+ * of a tick finish within that tick, a module must therefore fit into the
+ * base period. Every distinct set of due modules is validated and stored as a
+ * task graph once, a tick neither allocates nor takes a lock.
+ *
+ * Invalid periods, offsets and worker indices terminate the process at
+ * construction.
+ */
+class MultiRateModuleHandler : public IApplicationHandler {
+ public:
+  enum class TaskAffinity { MAIN, WORKER, ANY };
+
+  /**
+   * \brief Configuration of a single module.
+   */
+  struct RateConfig {
+    TaskAffinity affinity;                             ///< Thread the module shall run on.
+    std::shared_ptr<IApplicationHandler> application;  ///< The module.
+    std::chrono::microseconds period;                  ///< Period of the module, greater than zero.
+    std::chrono::microseconds offset{0};               ///< Release time within the period, less than the period.
+    std::size_t worker{0};                             ///< Index of the worker if affinity is WORKER.
+  };
+  using RateConfigList = std::vector<RateConfig>;
+
+  /**
+   * \brief Maximum number of ticks per hyperperiod.
+   */
+  static constexpr std::uint64_t kMaxTicksPerHyperperiod{100000};
+
+  /**
+   * \brief Construct a new Multi Rate Module Handler object with one worker
+   * per given core
+   * \param core_ids cores the worker threads are affined to
+   * \param priority priority of the worker threads
+   * \param modules modules with their rates
+   */
+  MultiRateModuleHandler(const std::vector<unsigned int> &core_ids, int priority, const RateConfigList &modules);
+
+  /**
+   * \brief Default destructor.
+   */
+  ~MultiRateModuleHandler() override = default;
+
+  /**
+   * \brief Initializes all modules.
+   *
+   * \return true if the initialization is successful, false otherwise.
+   */
+  bool Initialize() override;
+
+  /**
+   * \brief Resets all modules and restarts the schedule at the first tick.
+   *
+   * \return true if the reset is successful, false otherwise.
+   */
+  bool PrepareForExecute() override;
+
+  /**
+   * \brief Executes the modules due in the current tick.
+   *
+   * \return true if all executed modules succeeded, false otherwise.
+   */
+  bool Execute() override;
+
+  /**
+   * \brief Prepares all modules for shutdown.
+   */
+  bool PrepareForShutdown() override;
+
+  /**
+   * \brief Shuts down all modules.
+   */
+  bool Shutdown() override;
+
+  /**
+   * \brief Returns the period the handler must be triggered with.
+   */
+  std::chrono::microseconds GetBasePeriod() const noexcept;
+
+  /**
+   * \brief Returns the period after which the schedule repeats.
+   */
+  std::chrono::microseconds GetHyperperiod() const noexcept;
+
+  /**
+   * \brief Returns the modules due in the given tick of the hyperperiod, as
+   * indices into the configuration list in rate-monotonic order.
+   */
+  const std::vector<std::size_t> &GetDueModules(std::size_t tick) const noexcept;
+
+  /**
+   * \brief Enables runtime statistics of every module, named "<name>.<module index>", the index
+   * of a module is its position in the configuration list.
+   * \attention Must not be called while the handler executes.
+   */
+  void EnableModuleStatistics(const std::string &name,
+                              const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+                              const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend,
+                              float startup_wait_time =
+                                  daal::af::runtime_statistics::RuntimeStatistics::kStartupWaitTimeDefault,
+                              daal::af::runtime_statistics::RuntimeStatistics::Mode mode =
+                                  daal::af::runtime_statistics::RuntimeStatistics::Mode::kHistogram);
+
+  /**
+   * \brief Returns the runtime statistics of the modules.
+   */
+  daal::af::runtime_statistics::ModuleStatistics &GetModuleStatistics() noexcept;
+
+ protected:
+  MultiRateModuleHandler(const MultiRateModuleHandler &) = delete;
+  MultiRateModuleHandler &operator=(const MultiRateModuleHandler &) & = delete;
+  MultiRateModuleHandler(MultiRateModuleHandler &&) = delete;
+  MultiRateModuleHandler &operator=(MultiRateModuleHandler &&) & = delete;
+
+ private:
+  /**
+   * \brief Validates the configuration and computes base period and hyperperiod.
+   */
+  void ComputeTiming(const RateConfigList &modules);
+
+  /**
+   * \brief Builds the task graph running the given modules.
+   */
+  daal::af::worker::TaskGraph BuildGraph(const RateConfigList &modules, const std::vector<std::size_t> &due);
+
+  /**
+   * \brief Executes a module and measures it if enabled.
+   */
+  bool ExecuteModule(std::size_t module);
+
+  std::vector<std::shared_ptr<IApplicationHandler>> modules_;  ///< In configuration order.
+  std::chrono::microseconds base_period_;
+  std::chrono::microseconds hyperperiod_;
+  daal::af::runtime_statistics::ModuleStatistics module_statistics_;
+  daal::af::worker::WorkerPool worker_pool_;
+
+  std::vector<std::vector<std::size_t>> due_sets_;  ///< Distinct sets of due modules.
+  std::vector<daal::af::worker::TaskGraph> graphs_;  ///< One graph per due set.
+  std::vector<std::uint32_t> tick_due_sets_;         ///< Due set per tick of the hyperperiod.
+  std::size_t tick_;                                 ///< Tick executed next.
+};
+
+}  // namespace app_handler
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_APP_HANDLER_DETAILS_MULTI_RATE_MODULE_HANDLER_HPP
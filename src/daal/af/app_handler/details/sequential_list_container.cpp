@@ -38,8 +38,9 @@ bool SequentialAppHandlerContainer::PrepareForExecute() {
 
 bool SequentialAppHandlerContainer::Execute() {
   bool state = true;
-  for (const auto &app_handler : app_handlers_) {
-    state = state && app_handler->Execute();
+  for (std::size_t module = 0; module < app_handlers_.size(); ++module) {
+    const auto &app_handler = app_handlers_[module];
+    state = state && module_statistics_.Measure(module, [&app_handler]() { return app_handler->Execute(); });
   }
   return state;
 }
@@ -60,6 +61,18 @@ bool SequentialAppHandlerContainer::Shutdown() {
   return state;
 }
 
+void SequentialAppHandlerContainer::EnableModuleStatistics(
+    const std::string &name, const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+    const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend, float startup_wait_time,
+    daal::af::runtime_statistics::RuntimeStatistics::Mode mode) {
+  module_statistics_.Enable(name, app_handlers_.size(), time_provider, backend, startup_wait_time, mode);
+}
+
+daal::af::runtime_statistics::ModuleStatistics &
+SequentialAppHandlerContainer::GetModuleStatistics() noexcept {
+  return module_statistics_;
+}
+
 }  // namespace app_handler
 }  // namespace af
 }  // namespace daal
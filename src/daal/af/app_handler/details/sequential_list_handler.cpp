@@ -46,8 +46,9 @@ bool SequentialListAppHandler::PrepareForExecute() {
 
 bool SequentialListAppHandler::Execute() {
   bool state = true;
-  for (const auto &app : apps_) {
-    state = state && CheckState(app->Step());
+  for (std::size_t module = 0; module < apps_.size(); ++module) {
+    const auto &app = apps_[module];
+    state = state && module_statistics_.Measure(module, [this, &app]() { return CheckState(app->Step()); });
   }
   return state;
 }
@@ -68,6 +69,18 @@ bool SequentialListAppHandler::Shutdown() {
   return state;
 }
 
+void SequentialListAppHandler::EnableModuleStatistics(
+    const std::string &name, const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+    const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend, float startup_wait_time,
+    daal::af::runtime_statistics::RuntimeStatistics::Mode mode) {
+  module_statistics_.Enable(name, apps_.size(), time_provider, backend, startup_wait_time, mode);
+}
+
+daal::af::runtime_statistics::ModuleStatistics &
+SequentialListAppHandler::GetModuleStatistics() noexcept {
+  return module_statistics_;
+}
+
 }  // namespace app_handler
 }  // namespace af
 }  // namespace daal
@@ -15,10 +15,12 @@
 #define SRC_DAAL_AF_APP_HANDLER_SEQUENTIAL_LIST_HANDLER_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "daal/af/app_base/safe_application_base.hpp"
 #include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
 
 namespace daal {
 namespace af {
@@ -103,10 +105,30 @@ class SequentialListAppHandler : public IApplicationHandler {
    */
   bool Shutdown() override;
 
+  /**
+   * \brief Enables runtime statistics of every module, named "<name>.<module index>".
+   * The statistics skip the given startup wait time [µs] and collect the given mode like
+   * RuntimeStatistics.
+   * \attention Must not be called while the handler executes.
+   */
+  void EnableModuleStatistics(const std::string &name,
+                              const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+                              const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend,
+                              float startup_wait_time =
+                                  daal::af::runtime_statistics::RuntimeStatistics::kStartupWaitTimeDefault,
+                              daal::af::runtime_statistics::RuntimeStatistics::Mode mode =
+                                  daal::af::runtime_statistics::RuntimeStatistics::Mode::kHistogram);
+
+  /**
+   * \brief Returns the runtime statistics of the modules.
+   */
+  daal::af::runtime_statistics::ModuleStatistics &GetModuleStatistics() noexcept;
+
  private:
   bool CheckState(daal::af::app_base::MethodState);
 
   AppList apps_;
+  daal::af::runtime_statistics::ModuleStatistics module_statistics_;
 };
 
 }  // namespace app_handler
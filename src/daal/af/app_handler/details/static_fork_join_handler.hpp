@@ -0,0 +1,264 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_APP_HANDLER_DETAILS_STATIC_FORK_JOIN_HANDLER_HPP
+#define SRC_DAAL_AF_APP_HANDLER_DETAILS_STATIC_FORK_JOIN_HANDLER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/worker/worker_pool.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace app_handler {
+
+/**
+ * \brief Executor index of modules running on the thread calling Execute().
+ */
+constexpr std::size_t kMainThreadExecutor{std::numeric_limits<std::size_t>::max()};
+
+/**
+ * \brief Module of a StaticForkJoinHandler stage pinned to a worker.
+ *
+ * \tparam kWorkerIndex Index of the worker, kMainThreadExecutor for the
+ * calling thread.
+ * \tparam App Type of the module, providing the IApplicationHandler methods.
+ * It is stored by value and called without virtual dispatch.
+ */
+template <std::size_t kWorkerIndex, typename App>
+struct WorkerModule {
+  static constexpr std::size_t kWorker{kWorkerIndex};
+
+  WorkerModule() = default;
+  explicit WorkerModule(App application) : app{std::move(application)} {}
+
+  App app;
+};
+
+/**
+ * \brief Module of a StaticForkJoinHandler stage running on the calling thread.
+ */
+template <typename App>
+using MainModule = WorkerModule<kMainThreadExecutor, App>;
+
+/**
+ * \brief Stage of a StaticForkJoinHandler, all modules of a stage run
+ * concurrently and the stage finishes when all of them finished.
+ *
+ * \tparam Modules WorkerModule or MainModule types.
+ */
+template <typename... Modules>
+class ForkJoinStage {
+ public:
+  /**
+   * \brief Number of workers the stage uses, the highest worker index plus one.
+   */
+  static constexpr std::size_t kWorkerCount{
+      std::max({std::size_t{0}, (Modules::kWorker == kMainThreadExecutor ? 0 : Modules::kWorker + 1)...})};
+
+  ForkJoinStage() = default;
+  explicit ForkJoinStage(Modules... modules) : modules_{std::move(modules)...} {}
+
+  /**
+   * \brief Executes the modules bound to the given executor.
+   *
+   * \return true if all of them succeeded.
+   */
+  bool ExecuteOn(std::size_t executor) {
+    return std::apply(
+        [executor](auto &...module) {
+          bool success{true};
+          ((success = (std::decay_t<decltype(module)>::kWorker != executor || module.app.Execute()) && success), ...);
+          return success;
+        },
+        modules_);
+  }
+
+  /**
+   * \brief Calls the method on all modules in order on the calling thread.
+   *
+   * \return true if it succeeded on all modules.
+   */
+  template <typename Method>
+  bool ForEach(Method method) {
+    return std::apply(
+        [&method](auto &...module) {
+          bool success{true};
+          ((success = method(module.app) && success), ...);
+          return success;
+        },
+        modules_);
+  }
+
+  /**
+   * \brief Returns the module at the given position.
+   */
+  template <std::size_t kIndex>
+  auto &Get() noexcept {
+    return std::get<kIndex>(modules_).app;
+  }
+
+  /**
+   * \brief Entry point of the workers, passed to WorkerPool::Fork().
+   */
+  static bool RunOnWorker(void *stage, std::size_t worker) {
+    return static_cast<ForkJoinStage *>(stage)->ExecuteOn(worker);
+  }
+
+ private:
+  std::tuple<Modules...> modules_;
+};
+
+/**
+ * \class StaticForkJoinHandler
+ * \brief Fork-join handler whose topology is fixed at compile time.
+ *
+ * Stages, affinities and modules are type parameters, e.g.
+ * \code
+ * StaticForkJoinHandler<ForkJoinStage<MainModule<Sensor>>,
+ *                       ForkJoinStage<MainModule<Fusion>, WorkerModule<0, Planner>>>
+ * \endcode
+ * Stages run one after the other. For every stage with worker modules the
+ * workers receive a function pointer to the stage, instantiated at compile
+ * time, and each worker executes the modules pinned to it while the calling
+ * thread executes the main modules. Executing a cycle neither builds
+ * containers nor goes through std::function or virtual calls of the modules.
+ *
+ * Like ForkJoinModuleHandler, a failing module does not stop the cycle, the
+ * remaining stages still run and Execute() reports the failure. Lifecycle
+ * methods are called on the calling thread in stage order.
+ *
+ * \note Use ForkJoinModuleHandler if the topology is configured at runtime or
+ * needs stealable modules or dependencies across stages.
+ *
+ * \tparam Stages ForkJoinStage types in execution order.
+ */
+template <typename... Stages>
+class StaticForkJoinHandler final : public IApplicationHandler {
+  static_assert(sizeof...(Stages) > 0, "StaticForkJoinHandler needs at least one stage");
+
+ public:
+  /**
+   * \brief Number of workers the pool needs.
+   */
+  static constexpr std::size_t kWorkerCount{std::max({std::size_t{0}, Stages::kWorkerCount...})};
+
+  /**
+   * \brief Constructs the handler with default constructed modules.
+   *
+   * \param core_ids Cores of the workers, one per worker the topology uses.
+   * A mismatch terminates the process.
+   * \param priority Priority of the worker threads.
+   */
+  StaticForkJoinHandler(const std::vector<unsigned int> &core_ids, int priority)
+      : IApplicationHandler(), stages_{}, worker_pool_{CheckedCores(core_ids), priority} {}
+
+  /**
+   * \brief Constructs the handler from the given stages.
+   */
+  StaticForkJoinHandler(const std::vector<unsigned int> &core_ids, int priority, Stages... stages)
+      : IApplicationHandler(), stages_{std::move(stages)...}, worker_pool_{CheckedCores(core_ids), priority} {}
+
+  StaticForkJoinHandler(const StaticForkJoinHandler &) = delete;
+  StaticForkJoinHandler &operator=(const StaticForkJoinHandler &) = delete;
+  StaticForkJoinHandler(StaticForkJoinHandler &&) = delete;
+  StaticForkJoinHandler &operator=(StaticForkJoinHandler &&) = delete;
+  ~StaticForkJoinHandler() override = default;
+
+  bool Initialize() override {
+    return ForEach([](auto &app) { return app.Initialize(); });
+  }
+
+  bool PrepareForExecute() override {
+    return ForEach([](auto &app) { return app.PrepareForExecute(); });
+  }
+
+  bool Execute() override {
+    return std::apply(
+        [this](auto &...stage) {
+          bool success{true};
+          ((success = ExecuteStage(stage) && success), ...);
+          return success;
+        },
+        stages_);
+  }
+
+  bool PrepareForShutdown() override {
+    return ForEach([](auto &app) { return app.PrepareForShutdown(); });
+  }
+
+  bool Shutdown() override {
+    return ForEach([](auto &app) { return app.Shutdown(); });
+  }
+
+  /**
+   * \brief Returns the stage at the given position.
+   */
+  template <std::size_t kIndex>
+  auto &GetStage() noexcept {
+    return std::get<kIndex>(stages_);
+  }
+
+ private:
+  static const std::vector<unsigned int> &CheckedCores(const std::vector<unsigned int> &core_ids) {
+    if (core_ids.size() != kWorkerCount) {
+      daal::log::FrameworkLogger::get()->Error("Topology uses {} workers but {} cores are given", kWorkerCount,
+                                               core_ids.size());
+      exit(42);
+    }
+    return core_ids;
+  }
+
+  template <typename Stage>
+  bool ExecuteStage(Stage &stage) {
+    if constexpr (Stage::kWorkerCount == 0) {
+      return stage.ExecuteOn(kMainThreadExecutor);
+    } else {
+      worker_pool_.Fork(&Stage::RunOnWorker, &stage);
+      const bool kMainSuccess{stage.ExecuteOn(kMainThreadExecutor)};
+      return worker_pool_.Join() && kMainSuccess;
+    }
+  }
+
+  template <typename Method>
+  bool ForEach(Method method) {
+    return std::apply(
+        [&method](auto &...stage) {
+          bool success{true};
+          ((success = stage.ForEach(method) && success), ...);
+          return success;
+        },
+        stages_);
+  }
+
+  std::tuple<Stages...> stages_;
+  daal::af::worker::WorkerPool worker_pool_;
+};
+
+}  // namespace app_handler
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_APP_HANDLER_DETAILS_STATIC_FORK_JOIN_HANDLER_HPP
@@ -0,0 +1,146 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_APP_HANDLER_STATIC_SEQUENTIAL_HANDLER_H_
+#define SRC_DAAL_AF_APP_HANDLER_STATIC_SEQUENTIAL_HANDLER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "daal/af/app_base/safe_application_base.hpp"
+#include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
+
+namespace daal {
+namespace af {
+namespace app_handler {
+
+/**
+ * \brief Sequential handler of a list of applications fixed at compile time.
+ *
+ * Behaves like SequentialListAppHandler, but the applications are stored by
+ * value in a std::tuple and called through their concrete types: no
+ * reference counting, no pointer chasing and no virtual dispatch per module,
+ * so the compiler can inline small Step() functions. The executor still calls
+ * the handler through IApplicationHandler, once per cycle.
+ *
+ * An application is any type providing OnInitialize(), OnStart(), Step(),
+ * OnStop() and OnTerminate() returning a MethodState, e.g. a final class
+ * derived from SafeApplicationBase.
+ *
+ * \tparam Apps Types of the applications in execution order.
+ */
+template <typename... Apps>
+class StaticSequentialHandler final : public IApplicationHandler {
+  static_assert(sizeof...(Apps) > 0, "StaticSequentialHandler needs at least one application");
+
+ public:
+  /**
+   * \brief Default constructs all applications.
+   */
+  StaticSequentialHandler() = default;
+
+  /**
+   * \brief Construct a new StaticSequentialHandler object
+   * \param apps applications to execute, moved into the handler
+   */
+  explicit StaticSequentialHandler(Apps... apps) : apps_{std::move(apps)...} {}
+
+  StaticSequentialHandler(const StaticSequentialHandler &) = delete;
+  StaticSequentialHandler &operator=(const StaticSequentialHandler &) = delete;
+  StaticSequentialHandler(StaticSequentialHandler &&) = delete;
+  StaticSequentialHandler &operator=(StaticSequentialHandler &&) = delete;
+  ~StaticSequentialHandler() override = default;
+
+  bool Initialize() override {
+    return ForEach([](auto &app) { return app.OnInitialize(); });
+  }
+
+  bool PrepareForExecute() override {
+    return ForEach([](auto &app) { return app.OnStart(); });
+  }
+
+  bool Execute() override { return ExecuteModules(std::index_sequence_for<Apps...>{}); }
+
+  bool PrepareForShutdown() override {
+    return ForEach([](auto &app) { return app.OnStop(); });
+  }
+
+  bool Shutdown() override {
+    return ForEach([](auto &app) { return app.OnTerminate(); });
+  }
+
+  /**
+   * \brief Returns the application at the given position.
+   */
+  template <std::size_t kIndex>
+  auto &Get() noexcept {
+    return std::get<kIndex>(apps_);
+  }
+
+  /**
+   * \brief Enables runtime statistics of every module, named "<name>.<module index>".
+   * See SequentialListAppHandler::EnableModuleStatistics().
+   * \attention Must not be called while the handler executes.
+   */
+  void EnableModuleStatistics(const std::string &name,
+                              const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+                              const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend,
+                              float startup_wait_time =
+                                  daal::af::runtime_statistics::RuntimeStatistics::kStartupWaitTimeDefault,
+                              daal::af::runtime_statistics::RuntimeStatistics::Mode mode =
+                                  daal::af::runtime_statistics::RuntimeStatistics::Mode::kHistogram) {
+    module_statistics_.Enable(name, sizeof...(Apps), time_provider, backend, startup_wait_time, mode);
+  }
+
+  /**
+   * \brief Returns the runtime statistics of the modules.
+   */
+  daal::af::runtime_statistics::ModuleStatistics &GetModuleStatistics() noexcept { return module_statistics_; }
+
+ private:
+  static bool IsSuccessful(daal::af::app_base::MethodState state) noexcept {
+    return state == daal::af::app_base::MethodState::kSuccessful;
+  }
+
+  /**
+   * \brief Calls the method on the applications in order, stops at the first failure.
+   */
+  template <typename Method>
+  bool ForEach(Method method) {
+    return std::apply([&method](auto &...app) { return (IsSuccessful(method(app)) && ...); }, apps_);
+  }
+
+  template <std::size_t... kIndices>
+  bool ExecuteModules(std::index_sequence<kIndices...>) {
+    return (ExecuteModule<kIndices>() && ...);
+  }
+
+  template <std::size_t kIndex>
+  bool ExecuteModule() {
+    auto &app = std::get<kIndex>(apps_);
+    return module_statistics_.Measure(kIndex, [&app]() { return IsSuccessful(app.Step()); });
+  }
+
+  std::tuple<Apps...> apps_;
+  daal::af::runtime_statistics::ModuleStatistics module_statistics_;
+};
+
+}  // namespace app_handler
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_APP_HANDLER_STATIC_SEQUENTIAL_HANDLER_H_
@@ -0,0 +1,169 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "time_triggered_module_handler.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "daal/af/trigger/details/daal_steady_clock.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace app_handler {
+
+TimeTriggeredModuleHandler::TimeTriggeredModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                                                       std::vector<std::shared_ptr<IApplicationHandler>> modules,
+                                                       const ScheduleTable &table)
+    : IApplicationHandler(),
+      modules_{std::move(modules)},
+      hyperperiod_{table.hyperperiod},
+      module_statistics_{},
+      worker_pool_{core_ids, priority},
+      lanes_(core_ids.size() + 1),
+      cycle_start_{},
+      execute_start_{},
+      late_slots_{0} {
+  if (hyperperiod_.count() <= 0) {
+    daal::log::FrameworkLogger::get()->Error("Invalid hyperperiod {} us", table.hyperperiod.count());
+    exit(42);
+  }
+  for (std::size_t module = 0; module < modules_.size(); ++module) {
+    if (nullptr == modules_[module]) {
+      daal::log::FrameworkLogger::get()->Error("Module {} is not set", module);
+      exit(42);
+    }
+  }
+  for (const auto &entry : table.entries) {
+    if (entry.offset.count() < 0 || entry.offset >= table.hyperperiod) {
+      daal::log::FrameworkLogger::get()->Error("Schedule offset {} us outside of the hyperperiod",
+                                               entry.offset.count());
+      exit(42);
+    }
+    if (entry.module >= modules_.size()) {
+      daal::log::FrameworkLogger::get()->Error("Invalid module index {} in schedule", entry.module);
+      exit(42);
+    }
+    std::size_t lane{core_ids.size()};
+    if (entry.core != kMainThread) {
+      const auto kCore = std::find(core_ids.begin(), core_ids.end(), entry.core);
+      if (kCore == core_ids.end()) {
+        daal::log::FrameworkLogger::get()->Error("No worker on core {} in schedule", entry.core);
+        exit(42);
+      }
+      lane = static_cast<std::size_t>(kCore - core_ids.begin());
+    }
+    lanes_[lane].push_back({entry.offset, entry.module});
+  }
+  for (auto &lane : lanes_) {
+    std::stable_sort(lane.begin(), lane.end(),
+                     [](const Slot &lhs, const Slot &rhs) { return lhs.offset < rhs.offset; });
+  }
+}
+
+bool TimeTriggeredModuleHandler::Initialize() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->Initialize() && success;
+  }
+  return success;
+}
+
+bool TimeTriggeredModuleHandler::PrepareForExecute() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->PrepareForExecute() && success;
+  }
+  return success;
+}
+
+bool TimeTriggeredModuleHandler::Execute() {
+  // Start of the current hyperperiod on the global time grid
+  const auto kNow = daal::af::trigger::DAALSteadyClock::now();
+  cycle_start_ = kNow - (kNow.time_since_epoch() % hyperperiod_);
+  execute_start_ = kNow;
+
+  const std::size_t kWorkerCount{worker_pool_.Size()};
+  if (kWorkerCount != 0) {
+    worker_pool_.Fork(&TimeTriggeredModuleHandler::RunOnWorker, this);
+  }
+  bool success{RunLane(kWorkerCount)};
+  if (kWorkerCount != 0) {
+    success = worker_pool_.Join() && success;
+  }
+  return success;
+}
+
+bool TimeTriggeredModuleHandler::RunOnWorker(void *context, std::size_t worker) {
+  return static_cast<TimeTriggeredModuleHandler *>(context)->RunLane(worker);
+}
+
+bool TimeTriggeredModuleHandler::RunLane(std::size_t lane) {
+  bool success{true};
+  for (const auto &slot : lanes_[lane]) {
+    const auto kRelease = cycle_start_ + slot.offset;
+    const auto kNow = daal::af::trigger::DAALSteadyClock::now();
+    if (kNow > kRelease) {
+      // Slots released before the cycle started are delayed by the activation, not by the schedule
+      if (kRelease > execute_start_) {
+        late_slots_.fetch_add(1, std::memory_order_relaxed);
+      }
+    } else {
+      daal::af::trigger::DAALSteadyClock::sleep_until(kRelease);
+    }
+    const auto &application = modules_[slot.module];
+    success = module_statistics_.Measure(slot.module, [&application]() { return application->Execute(); }) && success;
+  }
+  return success;
+}
+
+bool TimeTriggeredModuleHandler::PrepareForShutdown() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->PrepareForShutdown() && success;
+  }
+  return success;
+}
+
+bool TimeTriggeredModuleHandler::Shutdown() {
+  bool success = true;
+  for (auto &module : modules_) {
+    success = module->Shutdown() && success;
+  }
+  return success;
+}
+
+std::uint64_t TimeTriggeredModuleHandler::GetLateSlotCount() const noexcept {
+  return late_slots_.load(std::memory_order_relaxed);
+}
+
+void TimeTriggeredModuleHandler::EnableModuleStatistics(
+    const std::string &name, const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+    const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend, float startup_wait_time,
+    daal::af::runtime_statistics::RuntimeStatistics::Mode mode) {
+  module_statistics_.Enable(name, modules_.size(), time_provider, backend, startup_wait_time, mode);
+}
+
+daal::af::runtime_statistics::ModuleStatistics &TimeTriggeredModuleHandler::GetModuleStatistics() noexcept {
+  return module_statistics_;
+}
+
+}  // namespace app_handler
+
+}  // namespace af
+
+}  // namespace daal
@@ -0,0 +1,188 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_APP_HANDLER_DETAILS_TIME_TRIGGERED_MODULE_HANDLER_HPP
+#define SRC_DAAL_AF_APP_HANDLER_DETAILS_TIME_TRIGGERED_MODULE_HANDLER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
+#include "daal/af/worker/worker_pool.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace app_handler {
+
+/**
+ * \brief The TimeTriggeredModuleHandler class executes modules according to a
+ * static, precomputed schedule table.
+ *
+ * The table lists the release time of every module as offset within the
+ * hyperperiod together with the core it runs on. It is generated offline, the
+ * handler makes no scheduling decision at runtime. The executor triggers the
+ * handler once per hyperperiod, e.g. with a PeriodicTrigger of that period.
+ * Execute() aligns the cycle to the global time grid of the hyperperiod, like
+ * PeriodicActivation does, and hands each core its part of the table. Every
+ * core sleeps until the next slot with DAALSteadyClock::sleep_until() and
+ * runs the module; cores do not synchronize with each other within the
+ * hyperperiod. Execute() returns once all cores finished their slots.
+ *
+ * A slot whose release time already passed when its core gets to it runs
+ * immediately. It is counted as late if it was released after Execute()
+ * started, i.e. a previous module of its core overran. Delays of the
+ * activation itself are reported by the executor as wake-up jitter.
+ *
+ * Unset modules, entries on unknown cores, offsets outside the hyperperiod and
+ * invalid module indices terminate the process at construction.
+ */
+class TimeTriggeredModuleHandler : public IApplicationHandler {
+ public:
+  /**
+   * \brief Core of entries running on the thread calling Execute().
+   */
+  static constexpr unsigned int kMainThread{std::numeric_limits<unsigned int>::max()};
+
+  /**
+   * \brief A single slot of the schedule table.
+   */
+  struct ScheduleEntry {
+    std::chrono::microseconds offset;  ///< Release time within the hyperperiod.
+    unsigned int core;                 ///< Core of a worker or kMainThread.
+    std::size_t module;                ///< Index of the module.
+  };
+
+  /**
+   * \brief The schedule of one hyperperiod.
+   */
+  struct ScheduleTable {
+    std::chrono::microseconds hyperperiod;
+    std::vector<ScheduleEntry> entries;
+  };
+
+  /**
+   * \brief Construct a new Time Triggered Module Handler object with one
+   * worker per given core
+   * \param core_ids cores the worker threads are affined to
+   * \param priority priority of the worker threads
+   * \param modules the modules referenced by the table
+   * \param table the schedule
+   */
+  TimeTriggeredModuleHandler(const std::vector<unsigned int> &core_ids, int priority,
+                             std::vector<std::shared_ptr<IApplicationHandler>> modules, const ScheduleTable &table);
+
+  /**
+   * \brief Default destructor.
+   */
+  ~TimeTriggeredModuleHandler() override = default;
+
+  /**
+   * \brief Initializes all modules.
+   */
+  bool Initialize() override;
+
+  /**
+   * \brief Resets all modules.
+   */
+  bool PrepareForExecute() override;
+
+  /**
+   * \brief Executes the schedule of one hyperperiod.
+   *
+   * \return true if all modules succeeded, false otherwise.
+   */
+  bool Execute() override;
+
+  /**
+   * \brief Prepares all modules for shutdown.
+   */
+  bool PrepareForShutdown() override;
+
+  /**
+   * \brief Shuts down all modules.
+   */
+  bool Shutdown() override;
+
+  /**
+   * \brief Returns the number of slots that started after their release time.
+   */
+  std::uint64_t GetLateSlotCount() const noexcept;
+
+  /**
+   * \brief Enables runtime statistics of every module, named "<name>.<module index>".
+   * \attention Must not be called while the handler executes.
+   */
+  void EnableModuleStatistics(const std::string &name,
+                              const std::shared_ptr<daal::af::runtime_statistics::TimeProvider> &time_provider,
+                              const std::shared_ptr<daal::af::runtime_statistics::IReportingBackend> &backend,
+                              float startup_wait_time =
+                                  daal::af::runtime_statistics::RuntimeStatistics::kStartupWaitTimeDefault,
+                              daal::af::runtime_statistics::RuntimeStatistics::Mode mode =
+                                  daal::af::runtime_statistics::RuntimeStatistics::Mode::kHistogram);
+
+  /**
+   * \brief Returns the runtime statistics of the modules.
+   */
+  daal::af::runtime_statistics::ModuleStatistics &GetModuleStatistics() noexcept;
+
+ protected:
+  TimeTriggeredModuleHandler(const TimeTriggeredModuleHandler &) = delete;
+  TimeTriggeredModuleHandler &operator=(const TimeTriggeredModuleHandler &) & = delete;
+  TimeTriggeredModuleHandler(TimeTriggeredModuleHandler &&) = delete;
+  TimeTriggeredModuleHandler &operator=(TimeTriggeredModuleHandler &&) & = delete;
+
+ private:
+  /**
+   * \brief Slot of a core, sorted by offset.
+   */
+  struct Slot {
+    std::chrono::nanoseconds offset;
+    std::size_t module;
+  };
+
+  /**
+   * \brief Entry point of the workers.
+   */
+  static bool RunOnWorker(void *context, std::size_t worker);
+
+  /**
+   * \brief Runs the slots of a core in the current hyperperiod.
+   */
+  bool RunLane(std::size_t lane);
+
+  std::vector<std::shared_ptr<IApplicationHandler>> modules_;
+  std::chrono::nanoseconds hyperperiod_;
+  daal::af::runtime_statistics::ModuleStatistics module_statistics_;
+  daal::af::worker::WorkerPool worker_pool_;
+  std::vector<std::vector<Slot>> lanes_;  ///< One per worker, then the main thread.
+  std::chrono::steady_clock::time_point cycle_start_;    ///< Start of the hyperperiod on the time grid.
+  std::chrono::steady_clock::time_point execute_start_;  ///< Time Execute() was called.
+  std::atomic<std::uint64_t> late_slots_;
+};
+
+}  // namespace app_handler
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_APP_HANDLER_DETAILS_TIME_TRIGGERED_MODULE_HANDLER_HPP
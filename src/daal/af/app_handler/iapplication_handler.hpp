@@ -26,6 +26,8 @@
 #ifndef SRC_DAAL_AF_APP_HANDLER_IAPPLICATION_HANDLER_HPP
 #define SRC_DAAL_AF_APP_HANDLER_IAPPLICATION_HANDLER_HPP
 
+#include <cstdint>
+
 namespace daal {
 
 namespace af {
@@ -81,6 +83,18 @@ class IApplicationHandler {
    */
   virtual bool Shutdown() = 0;
 
+  /**
+   * \brief Sets how much load the application sheds to keep its deadlines.
+   *
+   * Level 0 is the nominal operation, higher levels skip more optional work.
+   * The executor raises the level while the cycle exceeds its budget, it is
+   * called between two executions only.
+   *
+   * \return True if the application supports the level. Handlers without
+   * optional work only support level 0.
+   */
+  virtual bool SetDegradationLevel(std::uint32_t level) { return level == 0U; }
+
  protected:
   /**
    * \brief Copy constructor.
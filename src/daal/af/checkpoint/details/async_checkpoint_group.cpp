@@ -0,0 +1,73 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "async_checkpoint_group.hpp"
+
+#include <utility>
+
+namespace daal {
+
+namespace af {
+
+namespace checkpoint {
+
+AsyncCheckpointGroup::AsyncCheckpointGroup(unsigned int core_id, int priority)
+    : checkpoints_{}, result_{}, busy_{false}, skipped_rounds_{0}, worker_{core_id, priority} {}
+
+void AsyncCheckpointGroup::Add(std::shared_ptr<ICheckpoint> checkpoint) {
+  checkpoints_.push_back(std::move(checkpoint));
+}
+
+const std::vector<std::shared_ptr<ICheckpoint>> &AsyncCheckpointGroup::GetCheckpoints() const noexcept {
+  return checkpoints_;
+}
+
+std::error_code AsyncCheckpointGroup::Trigger() {
+  if (checkpoints_.empty()) {
+    return {};
+  }
+  if (busy_.load(std::memory_order_acquire)) {
+    ++skipped_rounds_;
+    return {};
+  }
+  const std::error_code kLastResult{result_};
+  result_ = std::error_code{};
+  busy_.store(true, std::memory_order_relaxed);
+  if (!worker_.Post(&AsyncCheckpointGroup::RunRound, this, nullptr)) {
+    busy_.store(false, std::memory_order_relaxed);
+    return std::make_error_code(std::errc::resource_unavailable_try_again);
+  }
+  return kLastResult;
+}
+
+bool AsyncCheckpointGroup::IsBusy() const noexcept { return busy_.load(std::memory_order_acquire); }
+
+std::uint64_t AsyncCheckpointGroup::GetSkippedRounds() const noexcept { return skipped_rounds_; }
+
+bool AsyncCheckpointGroup::RunRound(void *group) {
+  auto *self = static_cast<AsyncCheckpointGroup *>(group);
+  std::error_code result{};
+  for (const auto &checkpoint : self->checkpoints_) {
+    const std::error_code kResult{checkpoint->Trigger()};
+    if (kResult) {
+      result = kResult;
+    }
+  }
+  self->result_ = result;
+  self->busy_.store(false, std::memory_order_release);
+  return !result;
+}
+
+}  // namespace checkpoint
+}  // namespace af
+}  // namespace daal
@@ -0,0 +1,107 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_CHECKPOINT_DETAILS_ASYNC_CHECKPOINT_GROUP_HPP
+#define SRC_DAAL_AF_CHECKPOINT_DETAILS_ASYNC_CHECKPOINT_GROUP_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#include "daal/af/checkpoint/icheckpoint.hpp"
+#include "daal/af/worker/worker_thread.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace checkpoint {
+
+/**
+ * @class AsyncCheckpointGroup
+ * @brief Triggers checkpoints on a background thread, off the cycle.
+ *
+ * Trigger() hands a round over to the background thread and returns without
+ * waiting: the round triggers all checkpoints in the order they were added.
+ * The result of a round is collected by the next Trigger(), so errors are
+ * reported with a delay of one cycle. If the previous round is still running
+ * the new round is skipped instead of queued, slow checkpoints thus neither
+ * block the cycle nor pile up.
+ *
+ * @note Trigger() and Add() must be called from one thread only.
+ */
+class AsyncCheckpointGroup {
+ public:
+  /**
+   * @brief Constructs the group and its background thread.
+   *
+   * @param core_id The core the background thread is affined to.
+   * @param priority The priority of the background thread.
+   */
+  AsyncCheckpointGroup(unsigned int core_id, int priority);
+
+  ~AsyncCheckpointGroup() = default;
+  AsyncCheckpointGroup(const AsyncCheckpointGroup &) = delete;
+  AsyncCheckpointGroup &operator=(const AsyncCheckpointGroup &) & = delete;
+  AsyncCheckpointGroup(AsyncCheckpointGroup &&) = delete;
+  AsyncCheckpointGroup &operator=(AsyncCheckpointGroup &&) & = delete;
+
+  /**
+   * @brief Adds a checkpoint, must not be called while a round is running.
+   */
+  void Add(std::shared_ptr<ICheckpoint> checkpoint);
+
+  /**
+   * @brief Returns the checkpoints in the order they are triggered.
+   */
+  const std::vector<std::shared_ptr<ICheckpoint>> &GetCheckpoints() const noexcept;
+
+  /**
+   * @brief Collects the result of the previous round and starts a new one.
+   *
+   * @return The error of the failed checkpoint triggered last in the previous
+   * round, no error if it succeeded, is still running or there was none.
+   */
+  std::error_code Trigger();
+
+  /**
+   * @brief Returns true while a round is running.
+   */
+  bool IsBusy() const noexcept;
+
+  /**
+   * @brief Returns the number of rounds skipped because the previous one was
+   * still running.
+   */
+  std::uint64_t GetSkippedRounds() const noexcept;
+
+ private:
+  /**
+   * @brief Task of the background thread, triggers one round.
+   */
+  static bool RunRound(void *group);
+
+  std::vector<std::shared_ptr<ICheckpoint>> checkpoints_;
+  std::error_code result_;        ///< Written by the round, read once busy_ was cleared.
+  std::atomic<bool> busy_;
+  std::uint64_t skipped_rounds_;
+  daal::af::worker::WorkerThread worker_;  ///< Last member, finishes a running round before the others go.
+};
+
+}  // namespace checkpoint
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_CHECKPOINT_DETAILS_ASYNC_CHECKPOINT_GROUP_HPP
@@ -13,10 +13,11 @@
 
 #include "checkpoint_container.hpp"
 
-#include <algorithm>
-#include <iterator>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <system_error>
+#include <utility>
 
 namespace daal {
 
@@ -26,31 +27,39 @@ namespace checkpoint {
 
 CheckpointContainer::CheckpointContainer() : ICheckpointContainer() {}
 
+CheckpointContainer::CheckpointContainer(unsigned int async_core_id, int async_priority)
+    : ICheckpointContainer(), async_core_id_{async_core_id}, async_priority_{async_priority} {}
+
 std::error_code CheckpointContainer::AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint) {
+  return AddCheckpoint(std::move(checkpoint), &TriggerAs<ICheckpoint>);
+}
+
+std::error_code CheckpointContainer::AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint, TriggerFunction trigger) {
   std::error_code error_code{};
 
-  if (nullptr == checkpoint) {
+  if ((nullptr == checkpoint) || (nullptr == trigger)) {
     error_code = std::make_error_code(std::errc::invalid_argument);
+  } else if (frozen_) {
+    error_code = std::make_error_code(std::errc::operation_not_permitted);
   } else {
     auto when = checkpoint->GetWhen();
-    auto check_item = [checkpoint](const std::shared_ptr<ICheckpoint> &item) {
-      bool ret = item == checkpoint;
-      ret = ret || item->GetName() == checkpoint->GetName();
-      return ret;
-    };
     switch (when) {
       case When::BEFORE:
-
-        if (std::find_if(before_checkpoints.begin(), before_checkpoints.end(), check_item) ==
-            before_checkpoints.end()) {
-          before_checkpoints.push_back(checkpoint);
+      case When::AFTER:
+        if (RegisterName(checkpoint->GetName(), when)) {
+          auto &checkpoints = (when == When::BEFORE) ? before_checkpoints : after_checkpoints;
+          checkpoints.push_back(Slot{trigger, checkpoint.get()});
+          owned_checkpoints.push_back(std::move(checkpoint));
         } else {
           error_code = std::make_error_code(std::errc::invalid_argument);
         }
         break;
-      case When::AFTER:
-        if (std::find_if(after_checkpoints.begin(), after_checkpoints.end(), check_item) == after_checkpoints.end()) {
-          after_checkpoints.push_back(checkpoint);
+      case When::ASYNC:
+        if (RegisterName(checkpoint->GetName(), when)) {
+          if (nullptr == async_checkpoints) {
+            async_checkpoints = std::make_unique<AsyncCheckpointGroup>(async_core_id_, async_priority_);
+          }
+          async_checkpoints->Add(std::move(checkpoint));
         } else {
           error_code = std::make_error_code(std::errc::invalid_argument);
         }
@@ -63,11 +72,88 @@ std::error_code CheckpointContainer::AddCheckpoint(std::shared_ptr<ICheckpoint>
   return error_code;
 }
 
+void CheckpointContainer::Freeze() {
+  if (frozen_) {
+    return;
+  }
+  frozen_checkpoints.reserve(before_checkpoints.size() + after_checkpoints.size());
+  frozen_checkpoints.insert(frozen_checkpoints.end(), before_checkpoints.begin(), before_checkpoints.end());
+  frozen_checkpoints.insert(frozen_checkpoints.end(), after_checkpoints.begin(), after_checkpoints.end());
+  frozen_after_begin_ = before_checkpoints.size();
+  std::vector<Slot>{}.swap(before_checkpoints);
+  std::vector<Slot>{}.swap(after_checkpoints);
+  owned_checkpoints.shrink_to_fit();
+  frozen_ = true;
+}
+
+bool CheckpointContainer::IsFrozen() const noexcept { return frozen_; }
+
+std::uint64_t CheckpointContainer::GetSkippedAsyncRounds() const noexcept {
+  return (nullptr == async_checkpoints) ? 0U : async_checkpoints->GetSkippedRounds();
+}
+
 std::error_code CheckpointContainer::TriggerCheckpoints(When when) const {
+  if (when == When::ASYNC) {
+    return (nullptr == async_checkpoints) ? std::error_code{} : async_checkpoints->Trigger();
+  }
+  const Slot *first{nullptr};
+  const Slot *last{nullptr};
+  GetSlots(when, first, last);
+
+  auto &statistics = (when == When::BEFORE) ? before_statistics_ : after_statistics_;
+  if (statistics.IsEnabled()) {
+    return TriggerMeasured(first, last, statistics);
+  }
+
+  std::error_code ec{};
+  for (; first != last; ++first) {
+    auto rec = first->trigger(first->checkpoint);
+    if (rec != std::error_code{}) {
+      ec = rec;
+    }
+  }
+
+  return ec;
+}
+
+void CheckpointContainer::EnableStatistics(const std::string &name,
+                                           const std::shared_ptr<runtime_statistics::TimeProvider> &time_provider,
+                                           const std::shared_ptr<runtime_statistics::IReportingBackend> &backend) {
+  for (const When when : {When::BEFORE, When::AFTER}) {
+    const Slot *first{nullptr};
+    const Slot *last{nullptr};
+    GetSlots(when, first, last);
+    std::vector<std::string> names;
+    for (const Slot *slot{first}; slot != last; ++slot) {
+      names.push_back(slot->checkpoint->GetName());
+    }
+    auto &statistics = (when == When::BEFORE) ? before_statistics_ : after_statistics_;
+    statistics.Enable(name + ((when == When::BEFORE) ? ".before" : ".after"), names, time_provider, backend);
+    for (std::size_t index = 0; index < names.size(); ++index) {
+      const auto kBudget = first[index].checkpoint->GetTimeBudget();
+      statistics.Get(index)->SetExecutionBudget(kBudget.count() > 0 ? static_cast<std::uint64_t>(kBudget.count())
+                                                                   : 0U);
+    }
+  }
+}
+
+runtime_statistics::ModuleStatistics &CheckpointContainer::GetStatistics(When when) noexcept {
+  return (when == When::AFTER) ? after_statistics_ : before_statistics_;
+}
+
+std::error_code CheckpointContainer::TriggerMeasured(const Slot *first, const Slot *last,
+                                                     runtime_statistics::ModuleStatistics &statistics) {
   std::error_code ec{};
-  const auto &checkpoints = (when == When::BEFORE) ? before_checkpoints : after_checkpoints;
-  for (const auto &checkpoint : checkpoints) {
-    auto rec = checkpoint->Trigger();
+  for (std::size_t index = 0; first != last; ++first, ++index) {
+    // checkpoints added after enabling the statistics have none
+    runtime_statistics::RuntimeStatistics *measurement{statistics.Get(index)};
+    if (nullptr != measurement) {
+      measurement->StartMeasurement();
+    }
+    auto rec = first->trigger(first->checkpoint);
+    if (nullptr != measurement) {
+      measurement->StopMeasurement();
+    }
     if (rec != std::error_code{}) {
       ec = rec;
     }
@@ -76,6 +162,32 @@ std::error_code CheckpointContainer::TriggerCheckpoints(When when) const {
   return ec;
 }
 
+void CheckpointContainer::GetSlots(When when, const Slot *&first, const Slot *&last) const noexcept {
+  if (frozen_) {
+    first = frozen_checkpoints.data() + ((when == When::BEFORE) ? 0U : frozen_after_begin_);
+    last = (when == When::BEFORE) ? frozen_checkpoints.data() + frozen_after_begin_
+                                  : frozen_checkpoints.data() + frozen_checkpoints.size();
+  } else {
+    const auto &checkpoints = (when == When::BEFORE) ? before_checkpoints : after_checkpoints;
+    first = checkpoints.data();
+    last = checkpoints.data() + checkpoints.size();
+  }
+}
+
+bool CheckpointContainer::RegisterName(const std::string &name, When when) {
+  const auto kEvent = static_cast<std::uint8_t>(1U << static_cast<unsigned int>(when));
+  const auto kInserted = name_ids_.emplace(name, name_events_.size());
+  if (kInserted.second) {
+    name_events_.push_back(0U);
+  }
+  std::uint8_t &events = name_events_[kInserted.first->second];
+  if ((events & kEvent) != 0U) {
+    return false;
+  }
+  events = static_cast<std::uint8_t>(events | kEvent);
+  return true;
+}
+
 }  // namespace checkpoint
 }  // namespace af
 }  // namespace daal
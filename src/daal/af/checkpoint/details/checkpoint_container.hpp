@@ -14,13 +14,19 @@
 #ifndef SRC_DAAL_AF_CHECKPOINT_DETAILS_CHECKPOINT_CONTAINER_HPP
 #define SRC_DAAL_AF_CHECKPOINT_DETAILS_CHECKPOINT_CONTAINER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <system_error>
+#include <unordered_map>
 #include <vector>
 
+#include "daal/af/checkpoint/details/async_checkpoint_group.hpp"
 #include "daal/af/checkpoint/icheckpoint.hpp"
 #include "daal/af/checkpoint/icheckpoint_container.hpp"
 #include "daal/af/checkpoint/when.hpp"
+#include "daal/af/runtime_statistics/module_statistics.hpp"
 
 namespace daal {
 
@@ -35,6 +41,18 @@ namespace checkpoint {
  * The CheckpointContainer class provides functionality to add and trigger
  * checkpoints. It maintains separate lists for checkpoints that should be
  * triggered before and after certain events.
+ *
+ * When::ASYNC checkpoints are triggered by an AsyncCheckpointGroup on a
+ * background thread, created with the first asynchronous checkpoint.
+ *
+ * Checkpoints are stored as pairs of trigger function and raw pointer, the
+ * shared pointers only keep them alive. Freeze() packs the pairs of both
+ * categories into one array and rejects further checkpoints. Names are
+ * interned on adding, a duplicate is found with one lookup.
+ *
+ * EnableStatistics() measures the checkpoints of When::BEFORE and When::AFTER
+ * individually, a checkpoint exceeding its time budget is counted as overrun
+ * in its statistics.
  */
 class CheckpointContainer : public ICheckpointContainer {
  public:
@@ -43,6 +61,15 @@ class CheckpointContainer : public ICheckpointContainer {
    */
   CheckpointContainer();
 
+  /**
+   * @brief Constructor placing the background thread of asynchronous
+   * checkpoints on the given core.
+   *
+   * @param async_core_id The core of the background thread.
+   * @param async_priority The priority of the background thread.
+   */
+  CheckpointContainer(unsigned int async_core_id, int async_priority);
+
   /**
    * @brief Default destructor for CheckpointContainer.
    */
@@ -57,11 +84,62 @@ class CheckpointContainer : public ICheckpointContainer {
    */
   std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint) override;
 
+  /**
+   * @brief Adds a checkpoint triggered through the given function.
+   *
+   * @param checkpoint A shared pointer to the checkpoint to be added.
+   * @param trigger The function triggering the checkpoint.
+   * @return std::error_code indicating success or failure of the operation,
+   * std::errc::operation_not_permitted once the container is frozen.
+   */
+  std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint, TriggerFunction trigger) override;
+
+  using ICheckpointContainer::AddCheckpoint;
+
+  /**
+   * @brief Packs the checkpoints of When::BEFORE and When::AFTER into one
+   * contiguous array, further checkpoints are rejected.
+   */
+  void Freeze() override;
+
+  /**
+   * @brief Returns whether Freeze() was called.
+   */
+  bool IsFrozen() const noexcept;
+
+  /**
+   * @brief Returns the number of When::ASYNC rounds skipped because the
+   * previous one was still running.
+   */
+  std::uint64_t GetSkippedAsyncRounds() const noexcept;
+
+  /**
+   * @brief Measures every checkpoint of When::BEFORE and When::AFTER from now
+   * on, named "<name>.before.<checkpoint name>" and "<name>.after.<checkpoint
+   * name>". Checkpoints added afterwards are not measured.
+   *
+   * @param name Prefix of the statistics.
+   * @param time_provider Clock of the measurements.
+   * @param backend Backend the statistics are reported to.
+   */
+  void EnableStatistics(const std::string &name,
+                        const std::shared_ptr<runtime_statistics::TimeProvider> &time_provider,
+                        const std::shared_ptr<runtime_statistics::IReportingBackend> &backend) override;
+
+  /**
+   * @brief Returns the statistics of the checkpoints of an event, in the order
+   * they were added.
+   *
+   * @param when When::BEFORE or When::AFTER.
+   */
+  runtime_statistics::ModuleStatistics &GetStatistics(When when) noexcept;
+
   /**
    * @brief Triggers all checkpoints for a given event.
    *
    * @param when The event for which checkpoints should be triggered.
    * @return std::error_code indicating success or failure of the operation.
+   * For When::ASYNC the result of the round started in the previous call.
    */
   std::error_code TriggerCheckpoints(When when) const override;
 
@@ -84,8 +162,45 @@ class CheckpointContainer : public ICheckpointContainer {
   CheckpointContainer &operator=(CheckpointContainer &&) & = default;
 
  private:
-  std::vector<std::shared_ptr<ICheckpoint>> before_checkpoints{};  ///< Checkpoints to be triggered before events.
-  std::vector<std::shared_ptr<ICheckpoint>> after_checkpoints{};   ///< Checkpoints to be triggered after events.
+  /**
+   * @brief A checkpoint as triggered every cycle.
+   */
+  struct Slot {
+    TriggerFunction trigger;  ///< Triggers the checkpoint.
+    ICheckpoint *checkpoint;  ///< The checkpoint, owned by owned_checkpoints.
+  };
+
+  /**
+   * @brief Interns the name of a checkpoint for the given event, fails if it
+   * is already taken there.
+   */
+  bool RegisterName(const std::string &name, When when);
+
+  /**
+   * @brief Returns the checkpoints of When::BEFORE or When::AFTER.
+   */
+  void GetSlots(When when, const Slot *&first, const Slot *&last) const noexcept;
+
+  /**
+   * @brief Triggers the given checkpoints and measures them.
+   */
+  static std::error_code TriggerMeasured(const Slot *first, const Slot *last,
+                                         runtime_statistics::ModuleStatistics &statistics);
+
+  std::vector<std::shared_ptr<ICheckpoint>> owned_checkpoints{};  ///< Keeps the checkpoints alive.
+  std::vector<Slot> before_checkpoints{};                          ///< Checkpoints to be triggered before events.
+  std::vector<Slot> after_checkpoints{};                           ///< Checkpoints to be triggered after events.
+  std::vector<Slot> frozen_checkpoints{};                          ///< Before, then after checkpoints once frozen.
+  std::size_t frozen_after_begin_{0};                              ///< First after checkpoint once frozen.
+  bool frozen_{false};                                             ///< Whether Freeze() was called.
+  std::unordered_map<std::string, std::size_t> name_ids_{};        ///< Interned checkpoint names.
+  std::vector<std::uint8_t> name_events_{};                        ///< Events using a name, bit per When.
+  // Measuring does not change the observable state of the container
+  mutable runtime_statistics::ModuleStatistics before_statistics_{};  ///< Per checkpoint, enabled on demand.
+  mutable runtime_statistics::ModuleStatistics after_statistics_{};   ///< Per checkpoint, enabled on demand.
+  unsigned int async_core_id_{0};                                  ///< Core of the asynchronous checkpoints.
+  int async_priority_{0};                                          ///< Priority of the asynchronous checkpoints.
+  std::unique_ptr<AsyncCheckpointGroup> async_checkpoints{};       ///< Created on the first ASYNC checkpoint.
 };
 
 }  // namespace checkpoint
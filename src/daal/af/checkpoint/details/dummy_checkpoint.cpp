@@ -21,7 +21,12 @@ namespace monitoring {
 
 DummyCheckpoint::DummyCheckpoint(std::string name, daal::af::checkpoint::When when)
     : daal::af::checkpoint::ICheckpoint(), name_{name}, when_{when} {
-  auto when_str = when_ == daal::af::checkpoint::When::BEFORE ? "BEFORE" : "AFTER";
+  const char *when_str{"AFTER"};
+  if (when_ == daal::af::checkpoint::When::BEFORE) {
+    when_str = "BEFORE";
+  } else if (when_ == daal::af::checkpoint::When::ASYNC) {
+    when_str = "ASYNC";
+  }
   daal::log::FrameworkLogger::get()->Info("DummyCheckpoint::DummyCheckpoint() {} {}", name_, when_str);
 }
 
@@ -0,0 +1,118 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "parallel_checkpoint_container.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace checkpoint {
+
+ParallelCheckpointContainer::ParallelCheckpointContainer(const std::vector<unsigned int> &core_ids, int priority)
+    : ICheckpointContainer(),
+      worker_pool_{core_ids, priority},
+      before_{std::make_unique<Category>(core_ids.size())},
+      after_{std::make_unique<Category>(core_ids.size())} {}
+
+std::error_code ParallelCheckpointContainer::AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint) {
+  return AddCheckpoint(std::move(checkpoint), {});
+}
+
+std::error_code ParallelCheckpointContainer::AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint,
+                                                           const std::vector<std::string> &depends_on) {
+  if (nullptr == checkpoint) {
+    return std::make_error_code(std::errc::invalid_argument);
+  }
+  const When kWhen{checkpoint->GetWhen()};
+  if (kWhen != When::BEFORE && kWhen != When::AFTER) {
+    return std::make_error_code(std::errc::invalid_argument);
+  }
+  Category &category{(kWhen == When::BEFORE) ? *before_ : *after_};
+  if (category.graph.IsFinalized()) {
+    return std::make_error_code(std::errc::operation_not_permitted);
+  }
+
+  auto find_index = [&category](const std::string &name) {
+    const auto kIt =
+        std::find_if(category.checkpoints.begin(), category.checkpoints.end(),
+                     [&name](const std::shared_ptr<ICheckpoint> &item) { return item->GetName() == name; });
+    return static_cast<std::size_t>(std::distance(category.checkpoints.begin(), kIt));
+  };
+  if (std::find(category.checkpoints.begin(), category.checkpoints.end(), checkpoint) != category.checkpoints.end() ||
+      find_index(checkpoint->GetName()) != category.checkpoints.size()) {
+    return std::make_error_code(std::errc::invalid_argument);
+  }
+  std::vector<daal::af::worker::TaskGraph::NodeId> predecessors;
+  for (const auto &name : depends_on) {
+    const std::size_t kIndex{find_index(name)};
+    if (kIndex == category.checkpoints.size()) {
+      daal::log::FrameworkLogger::get()->Error("Checkpoint {} depends on unknown checkpoint {}",
+                                               checkpoint->GetName(), name);
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    predecessors.push_back(static_cast<daal::af::worker::TaskGraph::NodeId>(kIndex));
+  }
+
+  const std::size_t kIndex{category.checkpoints.size()};
+  category.checkpoints.push_back(std::move(checkpoint));
+  category.results.emplace_back();
+  Category *category_ptr{&category};
+  const auto kNode = category.graph.AddNode([category_ptr, kIndex]() {
+    category_ptr->results[kIndex] = category_ptr->checkpoints[kIndex]->Trigger();
+    return !category_ptr->results[kIndex];
+  });
+  for (const auto predecessor : predecessors) {
+    static_cast<void>(category.graph.AddDependency(predecessor, kNode));
+  }
+  return {};
+}
+
+std::error_code ParallelCheckpointContainer::TriggerCheckpoints(When when) const {
+  if (when != When::BEFORE && when != When::AFTER) {
+    return {};
+  }
+  Category &category{(when == When::BEFORE) ? *before_ : *after_};
+  if (!category.graph.IsFinalized() && !category.graph.Finalize()) {
+    return std::make_error_code(std::errc::state_not_recoverable);
+  }
+  if (category.graph.Execute(worker_pool_)) {
+    return {};
+  }
+  std::error_code ec{};
+  for (const auto &result : category.results) {
+    if (result) {
+      ec = result;
+    }
+  }
+  return ec;
+}
+
+void ParallelCheckpointContainer::Freeze() {
+  for (Category *category : {before_.get(), after_.get()}) {
+    if (!category->graph.IsFinalized() && !category->graph.Finalize()) {
+      daal::log::FrameworkLogger::get()->Error("Checkpoint graph could not be finalized");
+    }
+  }
+}
+
+}  // namespace checkpoint
+}  // namespace af
+}  // namespace daal
@@ -0,0 +1,127 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_CHECKPOINT_DETAILS_PARALLEL_CHECKPOINT_CONTAINER_HPP
+#define SRC_DAAL_AF_CHECKPOINT_DETAILS_PARALLEL_CHECKPOINT_CONTAINER_HPP
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "daal/af/checkpoint/icheckpoint.hpp"
+#include "daal/af/checkpoint/icheckpoint_container.hpp"
+#include "daal/af/checkpoint/when.hpp"
+#include "daal/af/worker/task_graph.hpp"
+#include "daal/af/worker/worker_pool.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace checkpoint {
+
+/**
+ * @class ParallelCheckpointContainer
+ * @brief A checkpoint container triggering independent checkpoints concurrently.
+ *
+ * Checkpoints are independent of each other unless they declare dependencies
+ * on checkpoints added before to the same category (When::BEFORE or
+ * When::AFTER). Triggering a category runs its checkpoints as a task graph
+ * on a worker pool and the calling thread, a checkpoint starts as soon as the
+ * checkpoints it depends on finished. TriggerCheckpoints() returns when all
+ * checkpoints of the category finished, so BEFORE checkpoints are joined
+ * before the application step.
+ *
+ * The graphs are finalized by Freeze() or on the first trigger of their
+ * category, adding checkpoints to a finalized category fails afterwards.
+ *
+ * @note Checkpoints are triggered on different threads, each checkpoint is
+ * triggered by one thread at a time.
+ * @note When::ASYNC checkpoints are not supported, add them to a
+ * CheckpointContainer.
+ * @note Waking the workers costs a few microseconds per trigger, use
+ * CheckpointContainer for checkpoints that are cheaper than that.
+ */
+class ParallelCheckpointContainer : public ICheckpointContainer {
+ public:
+  /**
+   * @brief Constructs the container and its worker pool.
+   *
+   * @param core_ids The cores the workers are affined to, one worker per entry.
+   * @param priority The priority of the worker threads.
+   */
+  ParallelCheckpointContainer(const std::vector<unsigned int> &core_ids, int priority);
+
+  ~ParallelCheckpointContainer() override = default;
+  ParallelCheckpointContainer(const ParallelCheckpointContainer &) = delete;
+  ParallelCheckpointContainer &operator=(const ParallelCheckpointContainer &) & = delete;
+  ParallelCheckpointContainer(ParallelCheckpointContainer &&) = delete;
+  ParallelCheckpointContainer &operator=(ParallelCheckpointContainer &&) & = delete;
+
+  /**
+   * @brief Adds a checkpoint independent of all other checkpoints.
+   *
+   * @param checkpoint A shared pointer to the checkpoint to be added.
+   * @return std::error_code indicating success or failure of the operation.
+   */
+  std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint) override;
+
+  /**
+   * @brief Adds a checkpoint triggered after the given checkpoints finished.
+   *
+   * @param checkpoint A shared pointer to the checkpoint to be added.
+   * @param depends_on Names of checkpoints of the same category added before.
+   * @return std::errc::invalid_argument if the checkpoint is invalid or
+   * asynchronous, its name is taken or a dependency is unknown, std::errc::operation_not_permitted if
+   * the category was triggered or frozen already.
+   */
+  std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint, const std::vector<std::string> &depends_on);
+
+  /**
+   * @brief Triggers all checkpoints of a category and waits until they finished.
+   *
+   * @param when The category to be triggered.
+   * @return The error of the failed checkpoint added last, no error if all
+   * succeeded.
+   */
+  std::error_code TriggerCheckpoints(When when) const override;
+
+  /**
+   * @brief Finalizes the graphs of both categories.
+   */
+  void Freeze() override;
+
+ private:
+  /**
+   * @brief Checkpoints of one category and their task graph.
+   */
+  struct Category {
+    explicit Category(std::size_t worker_count) : checkpoints{}, results{}, graph{worker_count} {}
+
+    std::vector<std::shared_ptr<ICheckpoint>> checkpoints;  ///< In insertion order.
+    std::vector<std::error_code> results;                   ///< Written by the node of the checkpoint only.
+    daal::af::worker::TaskGraph graph;                      ///< Node ids match the checkpoint indices.
+  };
+
+  // Executing the graphs does not change the observable state of the container
+  mutable daal::af::worker::WorkerPool worker_pool_;
+  std::unique_ptr<Category> before_;  ///< On the heap, the tasks refer to it.
+  std::unique_ptr<Category> after_;
+};
+
+}  // namespace checkpoint
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_CHECKPOINT_DETAILS_PARALLEL_CHECKPOINT_CONTAINER_HPP
@@ -14,7 +14,10 @@
 #ifndef SRC_DAAL_AF_CHECKPOINT_ICHECKPOINT_H_
 #define SRC_DAAL_AF_CHECKPOINT_ICHECKPOINT_H_
 
+#include <chrono>
+#include <string>
 #include <system_error>
+#include <type_traits>
 
 #include "daal/af/checkpoint/when.hpp"
 
@@ -88,8 +91,42 @@ class ICheckpoint {
    *
    */
   virtual std::string const &GetName() const = 0;
+
+  /*!
+   * \brief This function shall return the time one trigger may take, exceeding
+   * it is flagged by containers measuring their checkpoints. Zero, the
+   * default, disables the budget.
+   *
+   * \return std::chrono::microseconds
+   *
+   */
+  virtual std::chrono::microseconds GetTimeBudget() const { return std::chrono::microseconds{0}; }
 };
 
+/*!
+ * \brief Function triggering a checkpoint, stored by containers next to the
+ * checkpoint instead of dispatching through its vtable every cycle.
+ *
+ */
+using TriggerFunction = std::error_code (*)(ICheckpoint *);
+
+/*!
+ * \brief Triggers a checkpoint known to be of type T. The call is resolved at
+ * compile time if T is final, otherwise it is dispatched virtually.
+ *
+ * \return std::error_code of the checkpoint
+ *
+ */
+template <typename T>
+std::error_code TriggerAs(ICheckpoint *checkpoint) {
+  static_assert(std::is_base_of_v<ICheckpoint, T>, "T must implement ICheckpoint");
+  if constexpr (std::is_final_v<T>) {
+    return static_cast<T *>(checkpoint)->Trigger();
+  } else {
+    return checkpoint->Trigger();
+  }
+}
+
 }  // namespace checkpoint
 }  // namespace af
 }  // namespace daal
@@ -14,7 +14,10 @@
 #ifndef SRC_DAAL_AF_CHECKPOINT_ICHECKPOINT_CONTAINER_H_
 #define SRC_DAAL_AF_CHECKPOINT_ICHECKPOINT_CONTAINER_H_
 
+#include <memory>
+#include <string>
 #include <system_error>
+#include <utility>
 
 #include "daal/af/checkpoint/icheckpoint.hpp"
 #include "daal/af/checkpoint/when.hpp"
@@ -23,6 +26,11 @@ namespace daal {
 
 namespace af {
 
+namespace runtime_statistics {
+class IReportingBackend;
+class TimeProvider;
+}  // namespace runtime_statistics
+
 namespace checkpoint {
 
 /**
@@ -81,6 +89,53 @@ class ICheckpointContainer {
    * @return std::error_code indicating the success or failure of the operation.
    */
   virtual std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint) = 0;
+
+  /**
+   * @brief Adds a checkpoint of a known type, containers may trigger it
+   * without virtual dispatch.
+   *
+   * @param checkpoint A shared pointer to the checkpoint to be added.
+   * @return std::error_code indicating the success or failure of the operation.
+   */
+  template <typename T>
+  std::error_code AddCheckpoint(std::shared_ptr<T> checkpoint) {
+    return AddCheckpoint(std::shared_ptr<ICheckpoint>{std::move(checkpoint)}, &TriggerAs<T>);
+  }
+
+  /**
+   * @brief Adds a checkpoint together with the function triggering it. The
+   * default ignores the function.
+   *
+   * @param checkpoint A shared pointer to the checkpoint to be added.
+   * @param trigger The function triggering the checkpoint.
+   * @return std::error_code indicating the success or failure of the operation.
+   */
+  virtual std::error_code AddCheckpoint(std::shared_ptr<ICheckpoint> checkpoint, TriggerFunction trigger) {
+    static_cast<void>(trigger);
+    return AddCheckpoint(std::move(checkpoint));
+  }
+
+  /**
+   * @brief Signals that no more checkpoints are added, containers may compact
+   * their storage for triggering. Called by the executor builder on Build().
+   */
+  virtual void Freeze() {}
+
+  /**
+   * @brief Measures every checkpoint on its own from now on, the statistics
+   * are named "<name>.<checkpoint name>". The default does not measure.
+   *
+   * @param name Prefix of the statistics.
+   * @param time_provider Clock of the measurements.
+   * @param backend Backend the statistics are reported to.
+   */
+  virtual void EnableStatistics(const std::string &name,
+                                const std::shared_ptr<runtime_statistics::TimeProvider> &time_provider,
+                                const std::shared_ptr<runtime_statistics::IReportingBackend> &backend) {
+    static_cast<void>(name);
+    static_cast<void>(time_provider);
+    static_cast<void>(backend);
+  }
 };
 
 }  // namespace checkpoint
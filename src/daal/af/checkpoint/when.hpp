@@ -20,7 +20,14 @@ namespace af {
 
 namespace checkpoint {
 
-enum class When : int { BEFORE, AFTER };
+/**
+ * @brief Point in the cycle a checkpoint is triggered at.
+ *
+ * BEFORE and AFTER checkpoints finish before respectively after the
+ * application step. ASYNC checkpoints are handed to a background thread before
+ * the application step, their errors are reported in the next cycle.
+ */
+enum class When : int { BEFORE, AFTER, ASYNC };
 
 }  // namespace checkpoint
 }  // namespace af
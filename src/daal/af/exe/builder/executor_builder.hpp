@@ -40,12 +40,16 @@ class Finalize {
    * @brief Constructs and returns a unique pointer to an Executor instance.
    *
    * This method finalizes the building process by assembling all the components
-   * and creating an Executor instance.
+   * and creating an Executor instance. The checkpoint container is frozen, no
+   * checkpoints can be added afterwards.
    *
    * @return std::unique_ptr<Executor> A unique pointer to the constructed
    * Executor.
    */
   std::unique_ptr<Executor> Build() {
+    if (components_->checkpoint_container_) {
+      components_->checkpoint_container_->Freeze();
+    }
     return std::make_unique<Executor>(std::move(components_->exe_env_), std::move(components_->os_helper_),
                                       std::move(components_->trigger_), std::move(components_->checkpoint_container_));
   }
@@ -59,8 +63,14 @@ class CheckpointAdder {
   CheckpointAdder(std::shared_ptr<Components> components) : components_(components) {}
 
   CheckpointAdder &AddCheckpoint(std::shared_ptr<checkpoint::ICheckpoint> checkpoint) {
+    return AddCheckpoint<checkpoint::ICheckpoint>(std::move(checkpoint));
+  }
+
+  /** Adds a checkpoint of a known type, final types are triggered without virtual dispatch. */
+  template <typename T>
+  CheckpointAdder &AddCheckpoint(std::shared_ptr<T> checkpoint) {
     if (components_->checkpoint_container_) {
-      components_->checkpoint_container_->AddCheckpoint(checkpoint);
+      components_->checkpoint_container_->AddCheckpoint(std::move(checkpoint));
     } else {
       daal::log::FrameworkLogger::get()->Error("Checkpoint container is not set");
       std::terminate();
@@ -71,7 +81,7 @@ class CheckpointAdder {
   template <typename T, typename... Args>
   CheckpointAdder &CreateCheckpoint(Args &&...args) {
     auto checkpoint = std::make_shared<T>(std::forward<Args>(args)...);
-    return AddCheckpoint(checkpoint);
+    return AddCheckpoint<T>(std::move(checkpoint));
   }
 
   Finalize End() { return Finalize(components_); }
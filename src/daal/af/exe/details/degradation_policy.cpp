@@ -0,0 +1,89 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "degradation_policy.hpp"
+
+#include <cstdlib>
+
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+namespace af {
+namespace exe {
+
+DegradationPolicy::DegradationPolicy(std::chrono::microseconds budget, std::vector<DegradationStep> steps,
+                                     std::uint32_t degrade_after, std::uint32_t recover_after, float recover_ratio)
+    : budget_{0},
+      recover_threshold_{0},
+      steps_{},
+      degrade_after_{degrade_after},
+      recover_after_{recover_after},
+      level_{0},
+      overrun_cycles_{0},
+      recovered_cycles_{0} {
+  if (budget.count() <= 0) {
+    daal::log::FrameworkLogger::get()->Error("Execution time budget must be positive");
+    exit(42);
+  }
+  if (degrade_after == 0U || recover_after == 0U) {
+    daal::log::FrameworkLogger::get()->Error("Degradation and recovery need at least one cycle");
+    exit(42);
+  }
+  if (!(recover_ratio > 0.0F && recover_ratio <= 1.0F)) {
+    daal::log::FrameworkLogger::get()->Error("Recover ratio {} is not in (0, 1]", recover_ratio);
+    exit(42);
+  }
+  for (const auto &step : steps) {
+    if (!(step.period_scale >= 1.0F)) {
+      daal::log::FrameworkLogger::get()->Error("Period scale {} is less than 1", step.period_scale);
+      exit(42);
+    }
+  }
+  budget_ = static_cast<std::uint64_t>(budget.count());
+  recover_threshold_ = static_cast<std::uint64_t>(static_cast<float>(budget_) * recover_ratio);
+  steps_.reserve(steps.size() + 1U);
+  steps_.push_back(DegradationStep{});
+  steps_.insert(steps_.end(), steps.begin(), steps.end());
+}
+
+bool DegradationPolicy::Update(std::uint64_t gross_execution_time, std::uint64_t missed_cycles) noexcept {
+  if ((gross_execution_time > budget_) || (missed_cycles != 0U)) {
+    recovered_cycles_ = 0;
+    if (++overrun_cycles_ >= degrade_after_ && level_ < GetMaxLevel()) {
+      overrun_cycles_ = 0;
+      ++level_;
+      return true;
+    }
+  } else if (gross_execution_time <= recover_threshold_) {
+    overrun_cycles_ = 0;
+    if (++recovered_cycles_ >= recover_after_ && level_ > 0U) {
+      recovered_cycles_ = 0;
+      --level_;
+      return true;
+    }
+  } else {
+    overrun_cycles_ = 0;
+    recovered_cycles_ = 0;
+  }
+  return false;
+}
+
+std::uint32_t DegradationPolicy::GetLevel() const noexcept { return level_; }
+
+const DegradationStep &DegradationPolicy::GetStep() const noexcept { return steps_[level_]; }
+
+std::uint32_t DegradationPolicy::GetMaxLevel() const noexcept { return static_cast<std::uint32_t>(steps_.size() - 1U); }
+
+}  // namespace exe
+}  // namespace af
+}  // namespace daal
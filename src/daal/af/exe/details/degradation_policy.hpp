@@ -0,0 +1,107 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_EXE_DETAILS_DEGRADATION_POLICY_H_
+#define SRC_DAAL_AF_EXE_DETAILS_DEGRADATION_POLICY_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace daal {
+
+namespace af {
+namespace exe {
+
+/*!
+ * \brief Reaction of the executor on one degradation level.
+ */
+struct DegradationStep {
+  float period_scale{1.0F};      ///< Factor applied to the nominal period of the trigger, at least 1.
+  std::uint32_t shed_level{0};  ///< Degradation level passed to the application handler.
+};
+
+/*!
+ * \brief Decides from the measured gross execution time (GET) of the cycles
+ * how far the executor degrades to keep up with its schedule.
+ *
+ * The GET is the wall-clock time of a cycle, so it includes modules running on
+ * worker threads, waiting for them and preemption of the executor thread. A
+ * cycle following missed activations counts as overrun regardless of its GET.
+ *
+ * Level 0 is the nominal operation, level n applies the n-th configured step,
+ * e.g. first stretch the period, then skip the optional modules, then shed
+ * the low priority ones. The level is raised after a number of consecutive
+ * cycles exceeding the budget and lowered again after a longer run of
+ * cycles below a fraction of the budget. Cycles in between reset both runs,
+ * so the level does not toggle on every cycle.
+ */
+class DegradationPolicy {
+ public:
+  /*!
+   * \brief Construct a new DegradationPolicy object
+   *
+   * \param budget Gross execution time per cycle the application is
+   * designed for.
+   * \param steps Steps of the levels 1 to steps.size().
+   * \param degrade_after Consecutive cycles above the budget raising the level.
+   * \param recover_after Consecutive cycles below recover_ratio * budget
+   * lowering the level.
+   * \param recover_ratio Fraction of the budget considered as recovered.
+   */
+  DegradationPolicy(std::chrono::microseconds budget, std::vector<DegradationStep> steps,
+                    std::uint32_t degrade_after = 3U, std::uint32_t recover_after = 100U, float recover_ratio = 0.7F);
+
+  /*!
+   * \brief Accounts the last cycle.
+   *
+   * \param gross_execution_time GET of the last cycle [µs].
+   * \param missed_cycles Activations missed before the last cycle.
+   * \return true if the level changed.
+   */
+  bool Update(std::uint64_t gross_execution_time, std::uint64_t missed_cycles = 0U) noexcept;
+
+  /*!
+   * \brief Returns the current level, 0 if not degraded.
+   */
+  std::uint32_t GetLevel() const noexcept;
+
+  /*!
+   * \brief Returns the step of the current level.
+   */
+  const DegradationStep &GetStep() const noexcept;
+
+  /*!
+   * \brief Returns the highest level.
+   */
+  std::uint32_t GetMaxLevel() const noexcept;
+
+ private:
+  std::uint64_t budget_;             ///< [µs]
+  std::uint64_t recover_threshold_;  ///< [µs]
+  std::vector<DegradationStep> steps_;  ///< Nominal step first.
+  std::uint32_t degrade_after_;
+  std::uint32_t recover_after_;
+  std::uint32_t level_;
+  std::uint32_t overrun_cycles_;
+  std::uint32_t recovered_cycles_;
+};
+
+}  // namespace exe
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_EXE_DETAILS_DEGRADATION_POLICY_H_ */
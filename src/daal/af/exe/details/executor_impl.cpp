@@ -13,6 +13,8 @@
 
 #include "executor_impl.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <system_error>
 
@@ -29,6 +31,7 @@ constexpr float kDefaultFpuPrecision = 0.000001F;
 #include "daal/af/os/posix_helper.hpp"
 #include "daal/af/runtime_statistics/details/file_backend.hpp"
 #include "daal/af/runtime_statistics/runtime_statistics.hpp"
+#include "daal/af/trace/trace.hpp"
 #include "daal/af/trigger/trigger.hpp"
 #include "daal/log/framework_logger.hpp"
 
@@ -54,6 +57,9 @@ Executor::Executor(std::unique_ptr<env::ExecutionEnvironment> exe_env, std::uniq
       is_executor_initialised_{false},
       is_application_set_{false},
       app_iface_{nullptr},
+      deadline_checkpoint_{nullptr},
+      degradation_policy_{nullptr},
+      nominal_period_{0},
       name_{EXECUTABLE_NAME},
       runtime_statistics_{name_, std::make_shared<runtime_statistics::TimeProvider>(),
                           std::make_shared<runtime_statistics::FileBackend>()} {
@@ -62,6 +68,8 @@ Executor::Executor(std::unique_ptr<env::ExecutionEnvironment> exe_env, std::uniq
 
 auto Executor::Init() -> bool {
   if (not is_executor_initialised_) {
+    // the cycles run on this thread, its trace buffer is allocated here rather than in the first cycle
+    daal::af::trace::RegisterThread();
     bool init_success{false};
     init_success = exe_env_iface_->Init();
 
@@ -132,10 +140,17 @@ auto Executor::Run() -> bool {
     return false;
   }
 
+  nominal_period_ = trigger_iface_->GetPeriod();
+
   bool is_step_success{true};
   while (!exe_env_iface_->IsSigTerm() && is_step_success) {
     // Keep the old behaviour
     (void)trigger_iface_->CheckTriggerConditionAndWait();
+    const trigger::ActivationStatus activation{trigger_iface_->GetActivationStatus()};
+    runtime_statistics_.RecordActivation(
+        activation.missed_cycles,
+        static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(activation.wakeup_jitter).count()));
 
     const bool is_refresh_success{exe_env_iface_->Refresh()};
     if (!is_refresh_success) {
@@ -152,6 +167,14 @@ auto Executor::Run() -> bool {
       break;
     }
 
+    // Hand the asynchronous checkpoints over, errors of their previous round are reported now
+    const std::error_code ret_code_async{chkpt_container_iface_->TriggerCheckpoints(checkpoint::When::ASYNC)};
+    if (ret_code_async != ERR_CODE_OK) {
+      daal::log::FrameworkLogger::get()->Error("In Asynchronous Checkpoints of the previous cycle");
+      is_step_success = false;
+      break;
+    }
+
     // Run/Execute Application Handler if the
     is_step_success = app_iface_->Execute();
 
@@ -168,6 +191,20 @@ auto Executor::Run() -> bool {
     }
 
     runtime_statistics_.StopMeasurement();
+
+    // the gross time covers the modules on worker threads, the core time only the executor thread
+    if ((nullptr != degradation_policy_) &&
+        degradation_policy_->Update(runtime_statistics_.GetLastGrossExecutionTime(), activation.missed_cycles)) {
+      ApplyDegradationStep();
+    }
+
+    if ((nullptr != deadline_checkpoint_) && ((activation.missed_cycles != 0) || runtime_statistics_.IsOverrun())) {
+      if (deadline_checkpoint_->Trigger() != ERR_CODE_OK) {
+        daal::log::FrameworkLogger::get()->Error("In Triggering Deadline Checkpoint");
+        is_step_success = false;
+        break;
+      }
+    }
   }
 
   // Update the return with while loop state
@@ -199,6 +236,43 @@ void Executor::SetApplicationHandler(std::unique_ptr<app_handler::IApplicationHa
   }
 }
 
+void Executor::SetExecutionBudget(std::chrono::microseconds budget) noexcept {
+  runtime_statistics_.SetExecutionBudget(budget.count() > 0 ? static_cast<std::uint64_t>(budget.count()) : 0U);
+}
+
+void Executor::SetDeadlineCheckpoint(std::shared_ptr<checkpoint::ICheckpoint> checkpoint) noexcept {
+  deadline_checkpoint_ = std::move(checkpoint);
+}
+
+void Executor::SetDegradationPolicy(std::unique_ptr<DegradationPolicy> policy) noexcept {
+  degradation_policy_ = std::move(policy);
+}
+
+void Executor::EnableCheckpointStatistics() noexcept {
+  chkpt_container_iface_->EnableStatistics(name_, std::make_shared<runtime_statistics::TimeProvider>(),
+                                           std::make_shared<runtime_statistics::FileBackend>());
+}
+
+void Executor::ApplyDegradationStep() {
+  const DegradationStep &step{degradation_policy_->GetStep()};
+  daal::log::FrameworkLogger::get()->Warning("Degradation level {}: period scale {}, shed level {}",
+                                             degradation_policy_->GetLevel(), step.period_scale, step.shed_level);
+  if (nominal_period_.count() > 0) {
+    const auto kPeriod = std::chrono::duration_cast<std::chrono::nanoseconds>(nominal_period_ * step.period_scale);
+    if (!trigger_iface_->SetPeriod(kPeriod)) {
+      daal::log::FrameworkLogger::get()->Warning("Trigger rejected period of {} ns", kPeriod.count());
+    }
+  }
+  if (!app_iface_->SetDegradationLevel(step.shed_level)) {
+    daal::log::FrameworkLogger::get()->Warning("Application handler does not support shed level {}",
+                                               step.shed_level);
+  }
+}
+
+auto Executor::GetRuntimeStatistics() noexcept -> const runtime_statistics::RuntimeStatistics::Statistics & {
+  return runtime_statistics_.Get();
+}
+
 }  // namespace exe
 
 }  // namespace af
@@ -14,13 +14,16 @@
 #ifndef SRC_DAAL_AF_EXE_DETAILS_EXECUTOR_IMPL_H_
 #define SRC_DAAL_AF_EXE_DETAILS_EXECUTOR_IMPL_H_
 
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "daal/af/app_handler/iapplication_handler.hpp"
+#include "daal/af/checkpoint/icheckpoint.hpp"
 #include "daal/af/checkpoint/icheckpoint_container.hpp"
 #include "daal/af/env/execution_environment.hpp"
+#include "daal/af/exe/details/degradation_policy.hpp"
 #include "daal/af/exe/iexecutor.hpp"
 #include "daal/af/os/posix_helper.hpp"
 #include "daal/af/runtime_statistics/runtime_statistics.hpp"
@@ -56,7 +59,51 @@ class Executor : public IExecutor {
   auto Init() -> bool override;
   void SetApplicationHandler(std::unique_ptr<app_handler::IApplicationHandler>) noexcept;
 
+  /*!
+   * \brief Set the budget of the gross execution time per cycle. Cycles
+   * exceeding it are counted as overruns in the runtime statistics.
+   * A budget of zero disables the overrun detection.
+   */
+  void SetExecutionBudget(std::chrono::microseconds budget) noexcept;
+
+  /*!
+   * \brief Set a checkpoint triggered after every cycle that followed missed
+   * activations or exceeded the execution budget. A failing checkpoint stops
+   * the run like the checkpoints of the container.
+   */
+  void SetDeadlineCheckpoint(std::shared_ptr<checkpoint::ICheckpoint> checkpoint) noexcept;
+
+  /*!
+   * \brief Set the policy degrading the execution while the measured gross
+   * execution time of the cycles exceeds its budget or activations are missed. Each level change stretches the period
+   * of the trigger relative to its period at the start of Run() and passes the
+   * shed level to the application handler. Requires the runtime statistics to
+   * be enabled.
+   */
+  void SetDegradationPolicy(std::unique_ptr<DegradationPolicy> policy) noexcept;
+
+  /*!
+   * \brief Measure every checkpoint of the container on its own, reported
+   * next to the statistics of the cycle as "<executable>.before.<checkpoint>"
+   * and "<executable>.after.<checkpoint>". Checkpoints exceeding their time
+   * budget are counted as overruns. To be called once all checkpoints are
+   * added, the cycle statistics still include the checkpoints.
+   */
+  void EnableCheckpointStatistics() noexcept;
+
+  /*!
+   * \brief Runtime statistics of the cycle including the missed cycles,
+   * overruns and wake-up jitter.
+   */
+  auto GetRuntimeStatistics() noexcept -> const runtime_statistics::RuntimeStatistics::Statistics &;
+
  private:
+  /*!
+   * \brief Applies the step of the current degradation level to the trigger
+   * and the application handler.
+   */
+  void ApplyDegradationStep();
+
   std::unique_ptr<env::ExecutionEnvironment> exe_env_iface_;
   std::unique_ptr<os::IPosixHelper> os_helper_iface_;
   std::unique_ptr<trigger::Trigger> trigger_iface_;
@@ -64,6 +111,9 @@ class Executor : public IExecutor {
   bool is_executor_initialised_;
   bool is_application_set_;
   std::unique_ptr<app_handler::IApplicationHandler> app_iface_;
+  std::shared_ptr<checkpoint::ICheckpoint> deadline_checkpoint_;
+  std::unique_ptr<DegradationPolicy> degradation_policy_;
+  std::chrono::nanoseconds nominal_period_;
 
   const std::string name_;
   runtime_statistics::RuntimeStatistics runtime_statistics_;
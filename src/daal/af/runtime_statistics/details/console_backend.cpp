@@ -16,6 +16,8 @@
 #include <iomanip>
 #include <iostream>
 
+#include "histogram_report.hpp"
+
 namespace daal {
 namespace af {
 namespace runtime_statistics {
@@ -52,7 +54,21 @@ void ConsoleBackend::Show(const RuntimeStatistics::Statistics& statistics) noexc
             << "\"GET_MEAN\""
             << " : " << statistics.gross_execution_time.mean << ", "  //
             << "\"GET_STDDEV\""
-            << " : " << statistics.gross_execution_time.std_dev << " }\n";  //
+            << " : " << statistics.gross_execution_time.std_dev << ", "  //
+            << "\"WJ_MIN\""
+            << " : " << statistics.wakeup_jitter.minimum << ", "  //
+            << "\"WJ_MAX\""
+            << " : " << statistics.wakeup_jitter.maximum << ", "  //
+            << "\"WJ_MEAN\""
+            << " : " << statistics.wakeup_jitter.mean << ", "  //
+            << "\"WJ_STDDEV\""
+            << " : " << statistics.wakeup_jitter.std_dev << ", "  //
+            << "\"MISSED_CYCLES\""
+            << " : " << statistics.missed_cycles << ", "  //
+            << "\"OVERRUNS\""
+            << " : " << statistics.overrun_count;  //
+  WriteHistogramReports(std::cout, statistics);
+  std::cout << " }\n";
 }
 
 }  // namespace runtime_statistics
@@ -18,6 +18,7 @@
 #include <fstream>
 #include <iomanip>
 
+#include "histogram_report.hpp"
 #include "platform.hpp"
 
 namespace daal {
@@ -75,7 +76,21 @@ void FileBackend::Show(const RuntimeStatistics::Statistics& statistics) noexcept
           << "\"GET_MEAN\""
           << " : " << statistics.gross_execution_time.mean << ", "  //
           << "\"GET_STDDEV\""
-          << " : " << statistics.gross_execution_time.std_dev << " }\n";  //
+          << " : " << statistics.gross_execution_time.std_dev << ", "  //
+          << "\"WJ_MIN\""
+          << " : " << statistics.wakeup_jitter.minimum << ", "  //
+          << "\"WJ_MAX\""
+          << " : " << statistics.wakeup_jitter.maximum << ", "  //
+          << "\"WJ_MEAN\""
+          << " : " << statistics.wakeup_jitter.mean << ", "  //
+          << "\"WJ_STDDEV\""
+          << " : " << statistics.wakeup_jitter.std_dev << ", "  //
+          << "\"MISSED_CYCLES\""
+          << " : " << statistics.missed_cycles << ", "  //
+          << "\"OVERRUNS\""
+          << " : " << statistics.overrun_count;  //
+      WriteHistogramReports(out, statistics);
+      out << " }\n";
       out.close();
     }
   }
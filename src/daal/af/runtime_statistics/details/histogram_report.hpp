@@ -0,0 +1,61 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_RUNTIME_STATISTICS_DETAILS_HISTOGRAM_REPORT_HPP_
+#define SRC_DAAL_AF_RUNTIME_STATISTICS_DETAILS_HISTOGRAM_REPORT_HPP_
+
+#include <cstddef>
+#include <ostream>
+
+#include "daal/af/runtime_statistics/runtime_statistics.hpp"
+
+namespace daal {
+namespace af {
+namespace runtime_statistics {
+
+/** Append the percentiles and the non-empty buckets of the histogram of a time base to a JSON object, e.g.
+ * , "GET_P50" : 12, ..., "GET_HISTOGRAM" : [ [15, 3], [16, 120] ]
+ * where every bucket is given as [highest value, count]. Nothing is written in RuntimeStatistics::Mode::kBasic. */
+inline void WriteHistogramReport(std::ostream& out, const char* prefix, const RuntimeStatistics::Data& data) {
+  if (nullptr == data.histogram) {
+    return;
+  }
+  out << ", \"" << prefix << "_P50\" : " << data.p50     //
+      << ", \"" << prefix << "_P99\" : " << data.p99     //
+      << ", \"" << prefix << "_P99_9\" : " << data.p99_9  //
+      << ", \"" << prefix << "_P99_99\" : " << data.p99_99;
+  out << ", \"" << prefix << "_HISTOGRAM\" : [";
+  bool first{true};
+  for (std::size_t bucket = 0; bucket < LatencyHistogram::kBucketCount; ++bucket) {
+    const auto kCount = data.histogram->CountAt(bucket);
+    if (kCount != 0) {
+      out << (first ? " [" : ", [") << LatencyHistogram::HighestValueAt(bucket) << ", " << kCount << "]";
+      first = false;
+    }
+  }
+  out << " ]";
+}
+
+/** Append the histogram reports of all time bases to a JSON object. */
+inline void WriteHistogramReports(std::ostream& out, const RuntimeStatistics::Statistics& statistics) {
+  WriteHistogramReport(out, "DT", statistics.delta_time);
+  WriteHistogramReport(out, "CET", statistics.core_execution_time);
+  WriteHistogramReport(out, "GET", statistics.gross_execution_time);
+  WriteHistogramReport(out, "WJ", statistics.wakeup_jitter);
+}
+
+}  // namespace runtime_statistics
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_RUNTIME_STATISTICS_DETAILS_HISTOGRAM_REPORT_HPP_
@@ -0,0 +1,78 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "latency_histogram.hpp"
+
+#include <cmath>
+
+namespace daal {
+namespace af {
+namespace runtime_statistics {
+
+std::size_t LatencyHistogram::BucketIndex(std::uint64_t value) noexcept {
+  if (value > kMaxTrackableValue) {
+    value = kMaxTrackableValue;
+  }
+  if (value < 2 * kSubBuckets) {
+    return static_cast<std::size_t>(value);
+  }
+  // Position of the most significant bit selects the power of two range, the following bits the sub-bucket
+  const auto kMsb = static_cast<std::uint32_t>(63 - __builtin_clzll(value));
+  const std::uint32_t kShift{kMsb - kSubBucketBits};
+  return static_cast<std::size_t>((kShift + 1) * kSubBuckets + ((value >> kShift) - kSubBuckets));
+}
+
+std::uint64_t LatencyHistogram::HighestValueAt(const std::size_t bucket) noexcept {
+  if (bucket < 2 * kSubBuckets) {
+    return bucket;
+  }
+  const std::uint64_t kShift{bucket / kSubBuckets - 1};
+  const std::uint64_t kSubBucket{bucket % kSubBuckets + kSubBuckets};
+  return ((kSubBucket + 1) << kShift) - 1;
+}
+
+void LatencyHistogram::Reset() noexcept {
+  for (auto& count : counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  total_count_.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::Percentile(const double percentile) const noexcept {
+  const std::uint64_t kTotal{TotalCount()};
+  if (kTotal == 0) {
+    return 0;
+  }
+  const double kClamped{percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile)};
+  auto target = static_cast<std::uint64_t>(std::ceil(kClamped * static_cast<double>(kTotal) / 100.0));
+  target = target == 0 ? 1 : target;
+
+  std::uint64_t cumulative{0};
+  std::size_t last_used{0};
+  for (std::size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+    const std::uint64_t kCount{CountAt(bucket)};
+    if (kCount != 0) {
+      cumulative += kCount;
+      last_used = bucket;
+      if (cumulative >= target) {
+        return HighestValueAt(bucket);
+      }
+    }
+  }
+  // Values recorded concurrently to the query
+  return HighestValueAt(last_used);
+}
+
+}  // namespace runtime_statistics
+}  // namespace af
+}  // namespace daal
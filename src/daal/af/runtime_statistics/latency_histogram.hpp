@@ -0,0 +1,93 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_RUNTIME_STATISTICS_LATENCY_HISTOGRAM_HPP_
+#define SRC_DAAL_AF_RUNTIME_STATISTICS_LATENCY_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace daal {
+namespace af {
+namespace runtime_statistics {
+
+/** Fixed memory, log-linear latency histogram (HDR style).
+ *
+ * Values below 2 * kSubBuckets are counted exactly. Above, every power of two range is split into kSubBuckets
+ * linear buckets, so the relative error of a reported value is below 1 / kSubBuckets (~3%). Values up to
+ * kMaxTrackableValue (~71 minutes in µs) are tracked, larger values are counted in the last bucket.
+ *
+ * Recording is a single relaxed atomic increment and lock-free, percentiles can be queried from any thread while
+ * values are recorded.
+ */
+class LatencyHistogram {
+ public:
+  /** Number of bits of the linear sub-buckets per power of two. */
+  static constexpr std::uint32_t kSubBucketBits{5};
+
+  /** Number of linear sub-buckets per power of two. */
+  static constexpr std::uint64_t kSubBuckets{1ULL << kSubBucketBits};
+
+  /** Number of bits of the largest trackable value. */
+  static constexpr std::uint32_t kValueBits{32};
+
+  /** Largest value that is tracked with full precision. */
+  static constexpr std::uint64_t kMaxTrackableValue{(1ULL << kValueBits) - 1};
+
+  /** Total number of buckets. */
+  static constexpr std::size_t kBucketCount{(kValueBits - kSubBucketBits + 1) * kSubBuckets};
+
+  LatencyHistogram() = default;
+  ~LatencyHistogram() = default;
+  LatencyHistogram(const LatencyHistogram& other) = delete;
+  LatencyHistogram(LatencyHistogram&& other) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram& other) = delete;
+  LatencyHistogram& operator=(LatencyHistogram&& other) = delete;
+
+  /** Count the given value. */
+  void Record(std::uint64_t value) noexcept {
+    counts_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    total_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** Remove all counted values. */
+  void Reset() noexcept;
+
+  /** Number of counted values. */
+  std::uint64_t TotalCount() const noexcept { return total_count_.load(std::memory_order_relaxed); }
+
+  /** Number of values counted in the given bucket. */
+  std::uint64_t CountAt(std::size_t bucket) const noexcept { return counts_[bucket].load(std::memory_order_relaxed); }
+
+  /** Smallest value at or below which the given percentage [0, 100] of all values lies, reported as the highest
+   * value of its bucket. Returns 0 if no value was counted. */
+  std::uint64_t Percentile(double percentile) const noexcept;
+
+  /** Bucket counting the given value. */
+  static std::size_t BucketIndex(std::uint64_t value) noexcept;
+
+  /** Highest value counted in the given bucket. */
+  static std::uint64_t HighestValueAt(std::size_t bucket) noexcept;
+
+ private:
+  std::array<std::atomic<std::uint64_t>, kBucketCount> counts_{};
+  std::atomic<std::uint64_t> total_count_{0};
+};
+
+}  // namespace runtime_statistics
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_RUNTIME_STATISTICS_LATENCY_HISTOGRAM_HPP_
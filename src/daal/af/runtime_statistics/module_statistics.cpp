@@ -0,0 +1,58 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "module_statistics.hpp"
+
+#include "reporting_backend.hpp"
+
+namespace daal {
+namespace af {
+namespace runtime_statistics {
+
+void ModuleStatistics::Enable(const std::string& name, const std::size_t module_count,
+                              const std::shared_ptr<TimeProvider>& time_provider,
+                              const std::shared_ptr<IReportingBackend>& backend, const float startup_wait_time,
+                              const RuntimeStatistics::Mode mode) {
+  std::vector<std::string> module_names;
+  module_names.reserve(module_count);
+  for (std::size_t module = 0; module < module_count; ++module) {
+    module_names.push_back(std::to_string(module));
+  }
+  Enable(name, module_names, time_provider, backend, startup_wait_time, mode);
+}
+
+void ModuleStatistics::Enable(const std::string& name, const std::vector<std::string>& module_names,
+                              const std::shared_ptr<TimeProvider>& time_provider,
+                              const std::shared_ptr<IReportingBackend>& backend, const float startup_wait_time,
+                              const RuntimeStatistics::Mode mode) {
+  statistics_.clear();
+  statistics_.reserve(module_names.size());
+  for (const auto& module_name : module_names) {
+    statistics_.push_back(
+        std::make_unique<RuntimeStatistics>(name + "." + module_name, time_provider, backend, startup_wait_time, mode));
+  }
+}
+
+RuntimeStatistics* ModuleStatistics::Get(const std::size_t module) noexcept {
+  return module < statistics_.size() ? statistics_[module].get() : nullptr;
+}
+
+void ModuleStatistics::Show() noexcept {
+  for (auto& statistics : statistics_) {
+    statistics->Show();
+  }
+}
+
+}  // namespace runtime_statistics
+}  // namespace af
+}  // namespace daal
@@ -0,0 +1,95 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_RUNTIME_STATISTICS_MODULE_STATISTICS_HPP_
+#define SRC_DAAL_AF_RUNTIME_STATISTICS_MODULE_STATISTICS_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "runtime_statistics.hpp"
+
+namespace daal {
+namespace af {
+namespace runtime_statistics {
+
+class IReportingBackend;
+
+/** Optional runtime statistics of the modules of a composite application handler.
+ *
+ * Each module gets its own RuntimeStatistics named "<name>.<module index>". The statistics are created once by
+ * Enable(), measuring a module afterwards costs the clock reads of RuntimeStatistics only and does not allocate. As
+ * long as Enable() was not called, Measure() just calls the module.
+ *
+ * The statistics are reported through the backend when they are destroyed, like the statistics of the executor.
+ *
+ * \attention Enable() must not be called while modules are measured. A module must not be measured from several
+ * threads at the same time.
+ */
+class ModuleStatistics {
+ public:
+  ModuleStatistics() = default;
+  ~ModuleStatistics() = default;
+  ModuleStatistics(const ModuleStatistics& other) = delete;
+  ModuleStatistics(ModuleStatistics&& other) noexcept = default;
+  ModuleStatistics& operator=(const ModuleStatistics& other) = delete;
+  ModuleStatistics& operator=(ModuleStatistics&& other) noexcept = default;
+
+  /** Create the statistics of all modules. */
+  void Enable(const std::string& name, std::size_t module_count, const std::shared_ptr<TimeProvider>& time_provider,
+              const std::shared_ptr<IReportingBackend>& backend,
+              float startup_wait_time = RuntimeStatistics::kStartupWaitTimeDefault,
+              RuntimeStatistics::Mode mode = RuntimeStatistics::Mode::kHistogram);
+
+  /** Create the statistics of all modules, named "<name>.<module name>". */
+  void Enable(const std::string& name, const std::vector<std::string>& module_names,
+              const std::shared_ptr<TimeProvider>& time_provider, const std::shared_ptr<IReportingBackend>& backend,
+              float startup_wait_time = RuntimeStatistics::kStartupWaitTimeDefault,
+              RuntimeStatistics::Mode mode = RuntimeStatistics::Mode::kHistogram);
+
+  /** Statistics are enabled. */
+  bool IsEnabled() const noexcept { return !statistics_.empty(); }
+
+  /** Number of measured modules, zero if not enabled. */
+  std::size_t Size() const noexcept { return statistics_.size(); }
+
+  /** Call the given module and measure it if enabled. */
+  template <typename Function>
+  bool Measure(std::size_t module, Function&& function) {
+    if (module >= statistics_.size()) {
+      return function();
+    }
+    RuntimeStatistics& statistics{*statistics_[module]};
+    statistics.StartMeasurement();
+    const bool kResult{function()};
+    statistics.StopMeasurement();
+    return kResult;
+  }
+
+  /** Retrieve the statistics of a module, nullptr if not enabled. */
+  RuntimeStatistics* Get(std::size_t module) noexcept;
+
+  /** Report the statistics of all modules to the backend. */
+  void Show() noexcept;
+
+ private:
+  std::vector<std::unique_ptr<RuntimeStatistics>> statistics_{};
+};
+
+}  // namespace runtime_statistics
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_RUNTIME_STATISTICS_MODULE_STATISTICS_HPP_
@@ -41,21 +41,33 @@ void RuntimeStatistics::Data::Finalize(const std::uint64_t cycle_count) noexcept
   } else {
     std_dev = 0.0F;
   }
+  if (nullptr != histogram) {
+    p50 = static_cast<float>(histogram->Percentile(50.0));
+    p99 = static_cast<float>(histogram->Percentile(99.0));
+    p99_9 = static_cast<float>(histogram->Percentile(99.9));
+    p99_99 = static_cast<float>(histogram->Percentile(99.99));
+  }
 }
 
 void RuntimeStatistics::Statistics::Finalize() noexcept {
   gross_execution_time.Finalize(cycle_count);
   core_execution_time.Finalize(cycle_count);
   delta_time.Finalize(cycle_count);
+  wakeup_jitter.Finalize(cycle_count);
 }
 
 RuntimeStatistics::ScopeGuard::~ScopeGuard() { runtime_statistics_.get().StopMeasurement(); };
 
 RuntimeStatistics::RuntimeStatistics(std::string name, std::shared_ptr<TimeProvider> time_provider,
-                                     std::shared_ptr<IReportingBackend> backend, float startup_wait_time) noexcept
+                                     std::shared_ptr<IReportingBackend> backend, float startup_wait_time,
+                                     Mode mode) noexcept
     : time_provider_(std::move(time_provider)), backend_(std::move(backend)), startup_wait_time_(startup_wait_time) {
   statistics_ = {};
   statistics_.name = std::move(name);
+  if (mode == Mode::kHistogram) {
+    histograms_ = std::make_unique<std::array<LatencyHistogram, kMetricCount>>();
+  }
+  AttachHistograms();
 }
 
 RuntimeStatistics::~RuntimeStatistics() noexcept { Show(); }
@@ -87,6 +99,10 @@ void RuntimeStatistics::StopMeasurement() noexcept {
       const auto kDeltaCET = end_cpu_ - start_cpu_;
       const auto kDeltaDT = start_real_ - start_real_last_;
 
+      is_overrun_ = execution_budget_ != 0 && kDeltaGET > execution_budget_;
+      last_core_execution_time_ = kDeltaCET;
+      last_gross_execution_time_ = kDeltaGET;
+
       if (startup_wait_time_ >= kDeltaDT) {
         startup_wait_time_ -= kDeltaDT;
       } else {
@@ -95,7 +111,18 @@ void RuntimeStatistics::StopMeasurement() noexcept {
         statistics_.gross_execution_time.Update(kDeltaGET, statistics_.cycle_count);
         statistics_.core_execution_time.Update(kDeltaCET, statistics_.cycle_count);
         statistics_.delta_time.Update(kDeltaDT, statistics_.cycle_count);
+        statistics_.wakeup_jitter.Update(pending_wakeup_jitter_, statistics_.cycle_count);
+        statistics_.missed_cycles += pending_missed_cycles_;
+        statistics_.overrun_count += is_overrun_ ? 1U : 0U;
+        if (histograms_) {
+          (*histograms_)[static_cast<std::size_t>(Metric::kGrossExecutionTime)].Record(kDeltaGET);
+          (*histograms_)[static_cast<std::size_t>(Metric::kCoreExecutionTime)].Record(kDeltaCET);
+          (*histograms_)[static_cast<std::size_t>(Metric::kDeltaTime)].Record(kDeltaDT);
+          (*histograms_)[static_cast<std::size_t>(Metric::kWakeUpJitter)].Record(pending_wakeup_jitter_);
+        }
       }
+      pending_missed_cycles_ = 0;
+      pending_wakeup_jitter_ = 0;
     }
   }
 }
@@ -104,14 +131,44 @@ void RuntimeStatistics::Reset() noexcept {
   statistics_.gross_execution_time = {};
   statistics_.core_execution_time = {};
   statistics_.delta_time = {};
+  statistics_.wakeup_jitter = {};
   statistics_.cycle_count = 0;
+  statistics_.missed_cycles = 0;
+  statistics_.overrun_count = 0;
+  if (histograms_) {
+    for (auto& histogram : *histograms_) {
+      histogram.Reset();
+    }
+  }
+  AttachHistograms();
   start_real_ = 0;
   end_real_ = 0;
   start_cpu_ = 0;
   end_cpu_ = 0;
   start_real_last_ = 0;
+  is_overrun_ = false;
+  last_core_execution_time_ = 0;
+  last_gross_execution_time_ = 0;
+  pending_missed_cycles_ = 0;
+  pending_wakeup_jitter_ = 0;
 }
 
+void RuntimeStatistics::RecordActivation(const std::uint64_t missed_cycles,
+                                         const std::uint64_t wakeup_jitter) noexcept {
+  if (is_enabled_) {
+    pending_missed_cycles_ += missed_cycles;
+    pending_wakeup_jitter_ = wakeup_jitter;
+  }
+}
+
+void RuntimeStatistics::SetExecutionBudget(const std::uint64_t budget) noexcept { execution_budget_ = budget; }
+
+bool RuntimeStatistics::IsOverrun() const noexcept { return is_overrun_; }
+
+std::uint64_t RuntimeStatistics::GetLastCoreExecutionTime() const noexcept { return last_core_execution_time_; }
+
+std::uint64_t RuntimeStatistics::GetLastGrossExecutionTime() const noexcept { return last_gross_execution_time_; }
+
 const RuntimeStatistics::Statistics& RuntimeStatistics::Get() noexcept {
   if (is_enabled_) {
     statistics_.Finalize();
@@ -121,6 +178,21 @@ const RuntimeStatistics::Statistics& RuntimeStatistics::Get() noexcept {
 
 void RuntimeStatistics::Show() noexcept { backend_->Show(Get()); }
 
+RuntimeStatistics::Mode RuntimeStatistics::GetMode() const noexcept {
+  return histograms_ ? Mode::kHistogram : Mode::kBasic;
+}
+
+const LatencyHistogram* RuntimeStatistics::GetHistogram(const Metric metric) const noexcept {
+  return histograms_ ? &(*histograms_)[static_cast<std::size_t>(metric)] : nullptr;
+}
+
+void RuntimeStatistics::AttachHistograms() noexcept {
+  statistics_.gross_execution_time.histogram = GetHistogram(Metric::kGrossExecutionTime);
+  statistics_.core_execution_time.histogram = GetHistogram(Metric::kCoreExecutionTime);
+  statistics_.delta_time.histogram = GetHistogram(Metric::kDeltaTime);
+  statistics_.wakeup_jitter.histogram = GetHistogram(Metric::kWakeUpJitter);
+}
+
 }  // namespace runtime_statistics
 }  // namespace af
 }  // namespace daal
@@ -14,6 +14,7 @@
 #ifndef SRC_DAAL_AF_RUNTIME_STATISTICS_RUNTIME_STATISTICS_HPP_
 #define SRC_DAAL_AF_RUNTIME_STATISTICS_RUNTIME_STATISTICS_HPP_
 
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -21,6 +22,7 @@
 #include <memory>
 #include <string>
 
+#include "latency_histogram.hpp"
 #include "time_provider.hpp"
 
 namespace daal {
@@ -116,9 +118,29 @@ class IReportingBackend;
  *        \sigma = \sqrt{\frac{S_n}{n - 1}}
  *     \f]
  *
+ * In Mode::kHistogram every time base additionally feeds a LatencyHistogram, which provides the percentiles p50,
+ * p99, p99.9 and p99.99 that mean and standard deviation cannot tell. Mode::kBasic keeps the cheaper statistics only.
+ *
+ * Besides the time bases, deadline violations are counted: cycles missed by the activation and cycles whose gross
+ * execution time exceeds the execution budget. The delay of every activation behind its scheduled time is collected
+ * as wake-up jitter. The activation data is reported by the trigger via RecordActivation() before the cycle starts.
  */
 class RuntimeStatistics {
  public:
+  /** Selects which statistics are collected. */
+  enum class Mode {
+    /** Minimum, maximum, mean and standard deviation only. */
+    kBasic,
+    /** Additionally a latency histogram per time base for percentiles. */
+    kHistogram,
+  };
+
+  /** Time bases of the statistics. */
+  enum class Metric { kGrossExecutionTime = 0, kCoreExecutionTime = 1, kDeltaTime = 2, kWakeUpJitter = 3 };
+
+  /** Number of time bases. */
+  static constexpr std::size_t kMetricCount{4};
+
   /** Data collection used for storing time statistic data for various time
    * bases. */
   struct Data {
@@ -140,13 +162,22 @@ class RuntimeStatistics {
     /** Standard deviation of runtime since start or last reset [µs]. */
     float std_dev{0.0F};
 
+    /** Percentiles of runtime since start or last reset [µs], only calculated in Mode::kHistogram. */
+    float p50{0.0F};
+    float p99{0.0F};
+    float p99_9{0.0F};
+    float p99_99{0.0F};
+
+    /** Histogram of the runtime, nullptr in Mode::kBasic. Owned by the RuntimeStatistics. */
+    const LatencyHistogram* histogram{nullptr};
+
     /** Update the data using the given delta.
      * \attention This does not update the standard deviation. These are updated
      * on finalize() call */
     void Update(std::uint64_t delta, std::uint64_t cycle_count) noexcept;
 
     /** Finalize the statistic data by calculating the average and standard
-     * deviation values. */
+     * deviation values and the percentiles. */
     void Finalize(std::uint64_t cycle_count) noexcept;
   };
 
@@ -161,6 +192,15 @@ class RuntimeStatistics {
     /** Period time according to Gliwas definition. */
     Data delta_time{};
 
+    /** Delay of the activation behind its scheduled time. */
+    Data wakeup_jitter{};
+
+    /** Number of activations missed since start or last reset. */
+    std::uint64_t missed_cycles{0};
+
+    /** Number of cycles exceeding the execution budget since start or last reset. */
+    std::uint64_t overrun_count{0};
+
     /* TODO (Markus Braun, braun5m, 2025-08-05): add IPT */
     /** Number of cycles since start or last reset. */
     std::uint64_t cycle_count{0};
@@ -186,9 +226,12 @@ class RuntimeStatistics {
     std::reference_wrapper<RuntimeStatistics> runtime_statistics_;
   };
 
+  /** Real time to skip by default before starting to collect runtime statistics [µs]. */
+  constexpr static float kStartupWaitTimeDefault{1000000};
+
   RuntimeStatistics(std::string name, std::shared_ptr<TimeProvider> time_provider,
                     std::shared_ptr<IReportingBackend> backend,
-                    float startup_wait_time = kStartupWaitTimeDefault) noexcept;
+                    float startup_wait_time = kStartupWaitTimeDefault, Mode mode = Mode::kHistogram) noexcept;
 
   ~RuntimeStatistics() noexcept;
 
@@ -209,6 +252,23 @@ class RuntimeStatistics {
    * ScopeMeasurement() */
   void StopMeasurement() noexcept;
 
+  /** Report the activation of the upcoming cycle, to be called before StartMeasurement().
+   * \param missed_cycles Number of activations missed since the previous one.
+   * \param wakeup_jitter Delay of the activation behind its scheduled time [µs]. */
+  void RecordActivation(std::uint64_t missed_cycles, std::uint64_t wakeup_jitter) noexcept;
+
+  /** Set the budget of the gross execution time per cycle [µs], 0 disables the overrun detection. */
+  void SetExecutionBudget(std::uint64_t budget) noexcept;
+
+  /** True if the gross execution time of the last measured cycle exceeded the execution budget. */
+  bool IsOverrun() const noexcept;
+
+  /** Core execution time of the last measured cycle [µs], also measured during the startup wait time. */
+  std::uint64_t GetLastCoreExecutionTime() const noexcept;
+
+  /** Gross execution time of the last measured cycle [µs], also measured during the startup wait time. */
+  std::uint64_t GetLastGrossExecutionTime() const noexcept;
+
   /** Reset all statistic data. */
   void Reset() noexcept;
 
@@ -224,7 +284,16 @@ class RuntimeStatistics {
   /** Print statistic data to console. */
   void Show() noexcept;
 
+  /** Selected mode. */
+  Mode GetMode() const noexcept;
+
+  /** Retrieve the histogram of a time base for percentile queries at runtime, nullptr in Mode::kBasic. */
+  const LatencyHistogram* GetHistogram(Metric metric) const noexcept;
+
  private:
+  /** Let the data of the time bases point to their histograms. */
+  void AttachHistograms() noexcept;
+
   /** Runtime statistics are enabled */
   bool is_enabled_{true};
 
@@ -234,12 +303,30 @@ class RuntimeStatistics {
   /** Backend for outputting the runtime statistics. */
   std::shared_ptr<IReportingBackend> backend_;
 
-  /** Real time to wait skip before starting to collect runtime statistics [µs]. */
-  constexpr static float kStartupWaitTimeDefault{1000000};
-
   /** Remaining real time until collection of runtime statistics starts. */
   float startup_wait_time_{kStartupWaitTimeDefault};
 
+  /** Histograms per time base, indexed by Metric, only allocated in Mode::kHistogram. */
+  std::unique_ptr<std::array<LatencyHistogram, kMetricCount>> histograms_{};
+
+  /** Budget of the gross execution time per cycle [µs], 0 if disabled. */
+  std::uint64_t execution_budget_{0};
+
+  /** Last measured cycle exceeded the execution budget. */
+  bool is_overrun_{false};
+
+  /** Core execution time of the last measured cycle [µs]. */
+  std::uint64_t last_core_execution_time_{0};
+
+  /** Gross execution time of the last measured cycle [µs]. */
+  std::uint64_t last_gross_execution_time_{0};
+
+  /** Missed activations reported for the current cycle. */
+  std::uint64_t pending_missed_cycles_{0};
+
+  /** Wake-up jitter reported for the current cycle [µs]. */
+  std::uint64_t pending_wakeup_jitter_{0};
+
   /** Actual runtime statistic data. */
   Statistics statistics_{};
 
@@ -0,0 +1,58 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_SYNC_ATOMIC_WAIT_HPP_
+#define SRC_DAAL_AF_SYNC_ATOMIC_WAIT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace daal {
+namespace af {
+namespace sync {
+
+/**
+ * @brief Blocks the calling thread while the value of word equals expected.
+ *
+ * This is the building block for blocking hand-offs without a mutex on the
+ * fast path. On Linux it maps to a futex wait, other platforms use a fallback
+ * that only takes a lock while a thread is actually sleeping. Spurious wake-ups
+ * are possible, callers must re-check their condition.
+ */
+void AtomicWait(const std::atomic<std::uint32_t> &word, std::uint32_t expected) noexcept;
+
+/**
+ * @brief Like AtomicWait(), but gives up after the given timeout.
+ *
+ * @return false if the timeout expired, true if the thread was woken up or the
+ * value did not equal expected. Spurious wake-ups are possible as well.
+ */
+bool AtomicWaitFor(const std::atomic<std::uint32_t> &word, std::uint32_t expected,
+                   std::chrono::nanoseconds timeout) noexcept;
+
+/**
+ * @brief Wakes one thread blocked in AtomicWait() on the given word.
+ */
+void AtomicNotifyOne(std::atomic<std::uint32_t> &word) noexcept;
+
+/**
+ * @brief Wakes all threads blocked in AtomicWait() on the given word.
+ */
+void AtomicNotifyAll(std::atomic<std::uint32_t> &word) noexcept;
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_SYNC_ATOMIC_WAIT_HPP_
@@ -0,0 +1,115 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_SYNC_COMPLETION_LATCH_HPP_
+#define SRC_DAAL_AF_SYNC_COMPLETION_LATCH_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "daal/af/sync/atomic_wait.hpp"
+
+namespace daal {
+namespace af {
+namespace sync {
+
+/**
+ * @brief Reusable single-waiter latch that collects the results of a number of
+ * asynchronous tasks.
+ *
+ * The waiter arms the latch with the number of expected completions, every
+ * task reports its result with CountDown() and the waiter blocks in Wait()
+ * until all of them arrived. The latch spins for a short while before it goes
+ * to sleep, so short fork/join sections do not pay for a system call. Neither
+ * arming nor counting down allocates or takes a lock.
+ *
+ * The sleeping waiter is flagged in the same word as the count, so the final
+ * decrement is the last access of CountDown() to the latch and the wake-up
+ * only uses its address. The latch must nevertheless outlive the final
+ * CountDown() call, e.g. by destroying it only after Wait() returned.
+ */
+class CompletionLatch {
+ public:
+  CompletionLatch() = default;
+  ~CompletionLatch() = default;
+  CompletionLatch(const CompletionLatch &) = delete;
+  CompletionLatch &operator=(const CompletionLatch &) = delete;
+  CompletionLatch(CompletionLatch &&) = delete;
+  CompletionLatch &operator=(CompletionLatch &&) = delete;
+
+  /**
+   * @brief Arms the latch for the given number of completions.
+   * @attention Must not be called while a previous round is still pending.
+   */
+  void Reset(std::uint32_t count) noexcept {
+    success_.store(true, std::memory_order_relaxed);
+    pending_.store(count & kCountMask, std::memory_order_release);
+  }
+
+  /**
+   * @brief Reports the completion of one task.
+   * @param success Result of the task.
+   */
+  void CountDown(bool success) noexcept {
+    if (!success) {
+      success_.store(false, std::memory_order_relaxed);
+    }
+    // the waiter may destroy the latch once the count reached zero, only its address is used afterwards
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == (kSleeping | 1U)) {
+      AtomicNotifyOne(pending_);
+    }
+  }
+
+  /**
+   * @brief Returns true if all completions arrived.
+   */
+  bool IsReady() const noexcept { return (pending_.load(std::memory_order_acquire) & kCountMask) == 0; }
+
+  /**
+   * @brief Blocks until all completions arrived.
+   * @return true if all tasks reported success, false otherwise.
+   */
+  bool Wait() noexcept {
+    for (std::uint32_t spin = 0; spin < kSpinCount && !IsReady(); ++spin) {
+    }
+    std::uint32_t pending{pending_.load(std::memory_order_acquire)};
+    while ((pending & kCountMask) != 0) {
+      if ((pending & kSleeping) == 0) {
+        if (!pending_.compare_exchange_weak(pending, pending | kSleeping, std::memory_order_acquire)) {
+          continue;
+        }
+        pending |= kSleeping;
+      }
+      AtomicWait(pending_, pending);
+      pending = pending_.load(std::memory_order_acquire);
+    }
+    return success_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /** Number of polls before the waiter goes to sleep. */
+  static constexpr std::uint32_t kSpinCount{2000};
+  /** Flag of pending_ set while the waiter sleeps. */
+  static constexpr std::uint32_t kSleeping{0x80000000U};
+  /** Bits of pending_ holding the number of outstanding completions. */
+  static constexpr std::uint32_t kCountMask{~kSleeping};
+
+  std::atomic<std::uint32_t> pending_{0};  ///< Outstanding completions and kSleeping.
+  std::atomic<bool> success_{true};
+};
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_SYNC_COMPLETION_LATCH_HPP_
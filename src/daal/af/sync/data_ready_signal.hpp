@@ -0,0 +1,122 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_SYNC_DATA_READY_SIGNAL_HPP_
+#define SRC_DAAL_AF_SYNC_DATA_READY_SIGNAL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "daal/af/sync/atomic_wait.hpp"
+
+namespace daal {
+namespace af {
+namespace sync {
+
+/**
+ * @brief Wakes a consumer as soon as a producer published new data.
+ *
+ * Producers, e.g. the receive callbacks of IoHandlers, call Notify() for every
+ * new sample. The signal counts notifications in an epoch, a consumer
+ * remembers the last epoch it handled and blocks in WaitFor() until the epoch
+ * moved on. Notifications arriving while the consumer is busy are coalesced,
+ * none of them is lost. Notify() only issues a system call if the consumer is
+ * actually sleeping, it neither allocates nor takes a lock and may be called
+ * from any thread.
+ *
+ * A signal can be part of a group: notifying it notifies the group signal as
+ * well, so a consumer waiting for several inputs blocks on the group and
+ * checks the epochs of the single inputs when it wakes up.
+ */
+class DataReadySignal {
+ public:
+  DataReadySignal() = default;
+
+  /**
+   * @brief Constructs a signal that forwards its notifications to a group.
+   * @param group The group signal, must outlive this signal.
+   */
+  explicit DataReadySignal(DataReadySignal &group) noexcept : group_{&group} {}
+
+  ~DataReadySignal() = default;
+  DataReadySignal(const DataReadySignal &) = delete;
+  DataReadySignal &operator=(const DataReadySignal &) = delete;
+  DataReadySignal(DataReadySignal &&) = delete;
+  DataReadySignal &operator=(DataReadySignal &&) = delete;
+
+  /**
+   * @brief Publishes new data and wakes the waiting consumer.
+   */
+  void Notify() noexcept {
+    epoch_.fetch_add(1);
+    if (sleepers_.load() != 0) {
+      AtomicNotifyAll(epoch_);
+    }
+    if (nullptr != group_) {
+      group_->Notify();
+    }
+  }
+
+  /**
+   * @brief Returns the group signal, nullptr if the signal is not grouped.
+   */
+  const DataReadySignal *GetGroup() const noexcept { return group_; }
+
+  /**
+   * @brief Returns the number of notifications so far, wrapping around.
+   */
+  std::uint32_t GetEpoch() const noexcept { return epoch_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Blocks until the epoch differs from seen or the timeout expired.
+   *
+   * @param seen Epoch the consumer handled last.
+   * @param timeout Maximum time to block.
+   * @return true if new data was published, false on timeout.
+   */
+  bool WaitFor(std::uint32_t seen, std::chrono::nanoseconds timeout) noexcept {
+    return WaitUntil(seen, std::chrono::steady_clock::now() + timeout);
+  }
+
+  /**
+   * @brief Blocks until the epoch differs from seen or the deadline passed.
+   *
+   * @param seen Epoch the consumer handled last.
+   * @param deadline Point in time on the steady clock to give up at.
+   * @return true if new data was published, false on timeout.
+   */
+  bool WaitUntil(std::uint32_t seen, std::chrono::steady_clock::time_point deadline) noexcept {
+    while (GetEpoch() == seen) {
+      const auto kRemaining = deadline - std::chrono::steady_clock::now();
+      if (kRemaining <= std::chrono::nanoseconds{0}) {
+        return false;
+      }
+      sleepers_.fetch_add(1);
+      (void)AtomicWaitFor(epoch_, seen, kRemaining);
+      sleepers_.fetch_sub(1);
+    }
+    return true;
+  }
+
+ private:
+  std::atomic<std::uint32_t> epoch_{0};
+  std::atomic<std::uint32_t> sleepers_{0};
+  DataReadySignal *group_{nullptr};
+};
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_SYNC_DATA_READY_SIGNAL_HPP_
@@ -0,0 +1,65 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+
+#include "daal/af/sync/atomic_wait.hpp"
+
+namespace daal {
+namespace af {
+namespace sync {
+
+namespace {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex requires a plain 32 bit word");
+
+long Futex(const std::atomic<std::uint32_t> &word, int operation, std::uint32_t value,
+           const struct timespec *timeout = nullptr) noexcept {
+  // futexes are process private here, the word never lives in shared memory
+  return syscall(SYS_futex, reinterpret_cast<const std::uint32_t *>(&word), operation | FUTEX_PRIVATE_FLAG, value,
+                 timeout, nullptr, 0);
+}
+
+}  // namespace
+
+void AtomicWait(const std::atomic<std::uint32_t> &word, std::uint32_t expected) noexcept {
+  // EAGAIN (value already changed) and EINTR are both handled by the caller
+  // re-checking its condition
+  (void)Futex(word, FUTEX_WAIT, expected);
+}
+
+bool AtomicWaitFor(const std::atomic<std::uint32_t> &word, std::uint32_t expected,
+                   std::chrono::nanoseconds timeout) noexcept {
+  if (timeout <= std::chrono::nanoseconds{0}) {
+    return word.load() != expected;
+  }
+  const auto kSeconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  // FUTEX_WAIT takes a relative timeout measured on the monotonic clock
+  const struct timespec kTimeout{static_cast<time_t>(kSeconds.count()),
+                                 static_cast<long>((timeout - kSeconds).count())};
+  return Futex(word, FUTEX_WAIT, expected, &kTimeout) == 0 || errno != ETIMEDOUT;
+}
+
+void AtomicNotifyOne(std::atomic<std::uint32_t> &word) noexcept { (void)Futex(word, FUTEX_WAKE, 1); }
+
+void AtomicNotifyAll(std::atomic<std::uint32_t> &word) noexcept { (void)Futex(word, FUTEX_WAKE, INT_MAX); }
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
@@ -0,0 +1,101 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <pthread.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+#include "daal/af/sync/atomic_wait.hpp"
+
+namespace daal {
+namespace af {
+namespace sync {
+
+namespace {
+
+/* Platforms without futex share a small table of condition variables. The
+ * lock of a bucket is only taken by threads going to sleep and by notifiers
+ * when the bucket has sleepers, so the hand-off itself stays lock free. */
+struct WaitBucket {
+  pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  pthread_cond_t condition = PTHREAD_COND_INITIALIZER;
+  std::atomic<std::uint32_t> waiters{0};
+};
+
+constexpr std::size_t kBucketCount{16};
+
+WaitBucket &GetBucket(const void *address) noexcept {
+  static std::array<WaitBucket, kBucketCount> buckets{};
+  const auto kKey = reinterpret_cast<std::uintptr_t>(address);
+  return buckets[(kKey >> 6U) % kBucketCount];
+}
+
+void Notify(std::atomic<std::uint32_t> &word) noexcept {
+  auto &bucket = GetBucket(&word);
+  if (bucket.waiters.load() != 0) {
+    (void)pthread_mutex_lock(&bucket.mutex);
+    (void)pthread_cond_broadcast(&bucket.condition);
+    (void)pthread_mutex_unlock(&bucket.mutex);
+  }
+}
+
+}  // namespace
+
+void AtomicWait(const std::atomic<std::uint32_t> &word, std::uint32_t expected) noexcept {
+  auto &bucket = GetBucket(&word);
+  (void)pthread_mutex_lock(&bucket.mutex);
+  bucket.waiters.fetch_add(1);
+  if (word.load() == expected) {
+    (void)pthread_cond_wait(&bucket.condition, &bucket.mutex);
+  }
+  bucket.waiters.fetch_sub(1);
+  (void)pthread_mutex_unlock(&bucket.mutex);
+}
+
+bool AtomicWaitFor(const std::atomic<std::uint32_t> &word, std::uint32_t expected,
+                   std::chrono::nanoseconds timeout) noexcept {
+  if (timeout <= std::chrono::nanoseconds{0}) {
+    return word.load() != expected;
+  }
+  // The statically initialized conditions measure against the realtime clock
+  struct timespec deadline {};
+  (void)clock_gettime(CLOCK_REALTIME, &deadline);
+  const auto kNanoseconds = static_cast<std::int64_t>(deadline.tv_nsec) + timeout.count();
+  deadline.tv_sec += static_cast<time_t>(kNanoseconds / 1000000000);
+  deadline.tv_nsec = static_cast<long>(kNanoseconds % 1000000000);
+
+  auto &bucket = GetBucket(&word);
+  int result{0};
+  (void)pthread_mutex_lock(&bucket.mutex);
+  bucket.waiters.fetch_add(1);
+  if (word.load() == expected) {
+    result = pthread_cond_timedwait(&bucket.condition, &bucket.mutex, &deadline);
+  }
+  bucket.waiters.fetch_sub(1);
+  (void)pthread_mutex_unlock(&bucket.mutex);
+  return result != ETIMEDOUT;
+}
+
+// Buckets are shared between words, so every notification wakes all sleepers
+// of the bucket and lets them re-check their own word.
+void AtomicNotifyOne(std::atomic<std::uint32_t> &word) noexcept { Notify(word); }
+
+void AtomicNotifyAll(std::atomic<std::uint32_t> &word) noexcept { Notify(word); }
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
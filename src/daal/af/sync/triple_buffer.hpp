@@ -0,0 +1,112 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_SYNC_TRIPLE_BUFFER_HPP_
+#define SRC_DAAL_AF_SYNC_TRIPLE_BUFFER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace daal {
+namespace af {
+namespace sync {
+
+/**
+ * @brief Lock-free exchange of the latest value from one producer to one
+ * consumer without copying it.
+ *
+ * The three buffers take the roles back, middle and front. The producer
+ * writes into the back buffer in place and publishes it by swapping it with
+ * the middle buffer. The consumer takes the latest published value by swapping
+ * the middle buffer with its front buffer, which stays stable until the next
+ * Consume(). Both swaps are a single atomic exchange, neither side ever waits
+ * for the other, values published in between two Consume() calls are dropped
+ * except for the latest one. A value is never torn, the producer can not write
+ * into the buffer the consumer is reading.
+ *
+ * @attention Publish() and GetBack() must be called from one thread at a time,
+ * Consume() and GetFront() from one thread at a time.
+ * @attention The back buffer holds an older value after Publish(), the
+ * producer has to write the complete value before each Publish().
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() = default;
+  ~TripleBuffer() = default;
+  TripleBuffer(const TripleBuffer &) = delete;
+  TripleBuffer &operator=(const TripleBuffer &) = delete;
+  TripleBuffer(TripleBuffer &&) = delete;
+  TripleBuffer &operator=(TripleBuffer &&) = delete;
+
+  /**
+   * @brief Constructs all three buffers from the given value.
+   */
+  explicit TripleBuffer(const T &initial) : buffers_{Slot{initial}, Slot{initial}, Slot{initial}} {}
+
+  /**
+   * @brief Returns the buffer the producer writes the next value to.
+   */
+  T &GetBack() noexcept { return buffers_[back_].value; }
+
+  /**
+   * @brief Publishes the back buffer as the latest value.
+   */
+  void Publish() noexcept {
+    const std::uint8_t kPublished{static_cast<std::uint8_t>(back_ | kFresh)};
+    const std::uint8_t kPrevious{middle_.exchange(kPublished, std::memory_order_acq_rel)};
+    back_ = static_cast<std::uint8_t>(kPrevious & kIndexMask);
+  }
+
+  /**
+   * @brief Makes the latest published value the front buffer.
+   * @return true if a value was published since the previous call, the front
+   * buffer is unchanged otherwise.
+   */
+  bool Consume() noexcept {
+    if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0U) {
+      return false;
+    }
+    const std::uint8_t kPrevious{middle_.exchange(front_, std::memory_order_acq_rel)};
+    front_ = static_cast<std::uint8_t>(kPrevious & kIndexMask);
+    return true;
+  }
+
+  /**
+   * @brief Returns the value taken by the last Consume(), stable until the
+   * next Consume().
+   */
+  const T &GetFront() const noexcept { return buffers_[front_].value; }
+
+ private:
+  /** Marks the middle buffer as published and not consumed yet. */
+  static constexpr std::uint8_t kFresh{0x4U};
+  static constexpr std::uint8_t kIndexMask{0x3U};
+
+  /** Buffers on their own cache lines, producer and consumer do not share one. */
+  struct alignas(64) Slot {
+    T value{};
+  };
+
+  std::array<Slot, 3> buffers_{};
+  alignas(64) std::atomic<std::uint8_t> middle_{1};  ///< Index of the middle buffer and kFresh.
+  alignas(64) std::uint8_t back_{0};                ///< Owned by the producer.
+  alignas(64) std::uint8_t front_{2};               ///< Owned by the consumer.
+};
+
+}  // namespace sync
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_SYNC_TRIPLE_BUFFER_HPP_
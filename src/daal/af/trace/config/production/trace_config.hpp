@@ -0,0 +1,38 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_TRACE_CONFIG_PRODUCTION_TRACE_CONFIG_H_
+#define SRC_DAAL_AF_TRACE_CONFIG_PRODUCTION_TRACE_CONFIG_H_
+
+#include <cstddef>
+
+namespace daal {
+namespace af {
+namespace trace {
+namespace config {
+
+/** Compile time switch of the tracepoints. Tracepoints are removed from the code at compile time if false. */
+constexpr bool kTracingEnabled{false};
+
+/** Number of records of the ring buffer of each thread, must be a power of two. */
+constexpr std::size_t kTraceBufferCapacity{4096};
+
+/** Maximum number of threads that can record tracepoints. */
+constexpr std::size_t kMaxTraceThreads{32};
+
+}  // namespace config
+}  // namespace trace
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_TRACE_CONFIG_PRODUCTION_TRACE_CONFIG_H_
@@ -0,0 +1,98 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * Decodes a trace file written by daal::af::trace::DumpTraces().
+ *
+ * Usage: trace_dump <trace file>
+ *
+ * Prints the records of all threads merged by time stamp, one record per line:
+ * <time since first record [us]> <thread> <event> <argument>
+ */
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+
+#include "daal/af/trace/trace.hpp"
+
+namespace {
+
+struct DecodedRecord {
+  std::uint32_t thread_index;
+  daal::af::trace::TraceRecord record;
+};
+
+template <typename T>
+bool Read(std::FILE *file, T *value, std::size_t count = 1) {
+  return std::fread(value, sizeof(T), count, file) == count;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fmt::print(stderr, "Usage: {} <trace file>\n", argv[0]);
+    return 1;
+  }
+  std::FILE *file{std::fopen(argv[1], "rb")};
+  if (nullptr == file) {
+    fmt::print(stderr, "Cannot open {}\n", argv[1]);
+    return 1;
+  }
+
+  daal::af::trace::TraceFileHeader file_header{};
+  if (!Read(file, &file_header) || file_header.magic != daal::af::trace::kTraceFileMagic ||
+      file_header.record_size != sizeof(daal::af::trace::TraceRecord)) {
+    fmt::print(stderr, "{} is not a trace file of this version\n", argv[1]);
+    std::fclose(file);
+    return 1;
+  }
+
+  std::vector<DecodedRecord> decoded;
+  std::vector<daal::af::trace::TraceRecord> records;
+  for (std::uint32_t buffer = 0; buffer < file_header.buffer_count; ++buffer) {
+    daal::af::trace::TraceBufferHeader buffer_header{};
+    if (!Read(file, &buffer_header)) {
+      fmt::print(stderr, "Truncated trace file\n");
+      std::fclose(file);
+      return 1;
+    }
+    records.resize(buffer_header.record_count);
+    if (!records.empty() && !Read(file, records.data(), records.size())) {
+      fmt::print(stderr, "Truncated trace file\n");
+      std::fclose(file);
+      return 1;
+    }
+    if (buffer_header.lost_count != 0) {
+      fmt::print(stderr, "Thread {} lost {} records\n", buffer_header.thread_index, buffer_header.lost_count);
+    }
+    for (const auto &record : records) {
+      decoded.push_back({buffer_header.thread_index, record});
+    }
+  }
+  std::fclose(file);
+
+  std::stable_sort(decoded.begin(), decoded.end(), [](const DecodedRecord &lhs, const DecodedRecord &rhs) {
+    return lhs.record.timestamp_ns < rhs.record.timestamp_ns;
+  });
+  const std::uint64_t kStart{decoded.empty() ? 0 : decoded.front().record.timestamp_ns};
+  for (const auto &entry : decoded) {
+    fmt::print("{:>14.3f} {:>3} {:<10} {}\n", static_cast<double>(entry.record.timestamp_ns - kStart) / 1000.0,
+               entry.thread_index, daal::af::trace::ToString(entry.record.event), entry.record.argument);
+  }
+  return 0;
+}
@@ -0,0 +1,135 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "trace.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+namespace af {
+namespace trace {
+
+namespace {
+
+/**
+ * @brief Owns the buffers of all threads that recorded tracepoints. Buffers live until the end of the process, so
+ * a dump still contains the records of threads that already terminated.
+ */
+class TraceRegistry {
+ public:
+  static TraceRegistry &Get() {
+    static TraceRegistry registry;
+    return registry;
+  }
+
+  TraceBuffer *Register() noexcept {
+    std::lock_guard<std::mutex> lock{mutex_};
+    const std::size_t kCount{count_.load(std::memory_order_relaxed)};
+    if (kCount == config::kMaxTraceThreads) {
+      return nullptr;
+    }
+    buffers_[kCount] = std::make_unique<TraceBuffer>(static_cast<std::uint32_t>(kCount));
+    count_.store(kCount + 1, std::memory_order_release);
+    return buffers_[kCount].get();
+  }
+
+  std::size_t Count() const noexcept { return count_.load(std::memory_order_acquire); }
+
+  const TraceBuffer &At(std::size_t index) const noexcept { return *buffers_[index]; }
+
+ private:
+  TraceRegistry() = default;
+
+  std::mutex mutex_;
+  std::atomic<std::size_t> count_{0};
+  std::array<std::unique_ptr<TraceBuffer>, config::kMaxTraceThreads> buffers_{};
+};
+
+}  // namespace
+
+namespace details {
+
+TraceBuffer *RegisterCurrentThread() noexcept {
+  TraceBuffer *buffer{TraceRegistry::Get().Register()};
+  if (nullptr == buffer) {
+    daal::log::FrameworkLogger::get()->Warning("Trace registry full, thread is not traced");
+  }
+  return buffer;
+}
+
+}  // namespace details
+
+bool DumpTraces(const std::string &path) {
+  std::FILE *file{std::fopen(path.c_str(), "wb")};
+  if (nullptr == file) {
+    daal::log::FrameworkLogger::get()->Error("Cannot open trace file {}", path);
+    return false;
+  }
+
+  const auto &registry = TraceRegistry::Get();
+  const std::size_t kBufferCount{registry.Count()};
+  const TraceFileHeader kFileHeader{kTraceFileMagic, static_cast<std::uint32_t>(sizeof(TraceRecord)),
+                                    static_cast<std::uint32_t>(kBufferCount)};
+  bool success{std::fwrite(&kFileHeader, sizeof(kFileHeader), 1, file) == 1};
+
+  std::vector<TraceRecord> records;
+  records.reserve(config::kTraceBufferCapacity);
+  for (std::size_t idx = 0; idx < kBufferCount && success; ++idx) {
+    const auto &buffer = registry.At(idx);
+    const std::uint64_t kEnd{buffer.WriteIndex()};
+    const std::uint64_t kBegin{kEnd > config::kTraceBufferCapacity ? kEnd - config::kTraceBufferCapacity : 0};
+    records.clear();
+    for (std::uint64_t record = kBegin; record < kEnd; ++record) {
+      records.push_back(buffer.At(record));
+    }
+    const TraceBufferHeader kBufferHeader{buffer.ThreadIndex(), static_cast<std::uint32_t>(records.size()), kBegin};
+    success = std::fwrite(&kBufferHeader, sizeof(kBufferHeader), 1, file) == 1;
+    if (success && !records.empty()) {
+      success = std::fwrite(records.data(), sizeof(TraceRecord), records.size(), file) == records.size();
+    }
+  }
+
+  success = (std::fclose(file) == 0) && success;
+  if (!success) {
+    daal::log::FrameworkLogger::get()->Error("Writing trace file {} failed", path);
+  }
+  return success;
+}
+
+const char *ToString(TraceEvent event) noexcept {
+  switch (event) {
+    case TraceEvent::kFork:
+      return "fork";
+    case TraceEvent::kSubmit:
+      return "submit";
+    case TraceEvent::kJoinStart:
+      return "join_start";
+    case TraceEvent::kJoinEnd:
+      return "join_end";
+    case TraceEvent::kNodeStart:
+      return "node_start";
+    case TraceEvent::kNodeEnd:
+      return "node_end";
+    default:
+      return "unknown";
+  }
+}
+
+}  // namespace trace
+}  // namespace af
+}  // namespace daal
@@ -0,0 +1,174 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_TRACE_TRACE_H_
+#define SRC_DAAL_AF_TRACE_TRACE_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "daal/af/trace/config/trace_config.hpp"
+
+namespace daal {
+namespace af {
+namespace trace {
+
+static_assert((config::kTraceBufferCapacity & (config::kTraceBufferCapacity - 1)) == 0,
+              "Trace buffer capacity must be a power of two");
+
+/**
+ * @brief Events recorded by the tracepoints.
+ */
+enum class TraceEvent : std::uint16_t {
+  kFork = 0,       ///< Work is handed to the worker pool.
+  kSubmit = 1,     ///< A task is posted to a worker, argument is the worker index.
+  kJoinStart = 2,  ///< The caller starts waiting for the workers.
+  kJoinEnd = 3,    ///< All workers are done.
+  kNodeStart = 4,  ///< A task graph node starts, argument is the node id.
+  kNodeEnd = 5,    ///< A task graph node finished, argument is the node id.
+};
+
+/**
+ * @brief A single binary trace record as stored in the ring buffers and in the dump file.
+ */
+struct TraceRecord {
+  std::uint64_t timestamp_ns;  ///< Steady clock time stamp.
+  std::uint32_t argument;      ///< Event specific argument.
+  TraceEvent event;
+  std::uint16_t reserved;
+};
+static_assert(sizeof(TraceRecord) == 16, "Trace records are dumped as raw bytes");
+
+/**
+ * @brief Header of a dump file written by DumpTraces().
+ *
+ * The header is followed by one TraceBufferHeader per thread, each followed by its records from the oldest to the
+ * newest one.
+ */
+struct TraceFileHeader {
+  std::array<char, 8> magic;  ///< "DAALTRC1"
+  std::uint32_t record_size;
+  std::uint32_t buffer_count;
+};
+
+/**
+ * @brief Per thread section of a dump file.
+ */
+struct TraceBufferHeader {
+  std::uint32_t thread_index;  ///< Registration order of the thread.
+  std::uint32_t record_count;  ///< Number of records following the header.
+  std::uint64_t lost_count;    ///< Number of records overwritten before the dump.
+};
+
+constexpr std::array<char, 8> kTraceFileMagic{'D', 'A', 'A', 'L', 'T', 'R', 'C', '1'};
+
+/**
+ * @brief Ring buffer of trace records written by a single thread.
+ *
+ * Recording a tracepoint stores a record and advances the write index, it neither formats, allocates nor locks. Old
+ * records are overwritten when the buffer is full.
+ */
+class TraceBuffer {
+ public:
+  explicit TraceBuffer(std::uint32_t thread_index) noexcept : thread_index_{thread_index} {}
+
+  void Record(TraceEvent event, std::uint32_t argument) noexcept {
+    const std::uint64_t kIndex{write_index_.load(std::memory_order_relaxed)};
+    const auto kNow = std::chrono::steady_clock::now().time_since_epoch();
+    records_[kIndex & (config::kTraceBufferCapacity - 1)] =
+        TraceRecord{static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(kNow).count()),
+                    argument, event, 0};
+    write_index_.store(kIndex + 1, std::memory_order_release);
+  }
+
+  std::uint32_t ThreadIndex() const noexcept { return thread_index_; }
+
+  /**
+   * @brief Number of records written since the thread was registered.
+   */
+  std::uint64_t WriteIndex() const noexcept { return write_index_.load(std::memory_order_acquire); }
+
+  const TraceRecord &At(std::uint64_t index) const noexcept {
+    return records_[index & (config::kTraceBufferCapacity - 1)];
+  }
+
+ private:
+  std::uint32_t thread_index_;
+  std::atomic<std::uint64_t> write_index_{0};
+  std::array<TraceRecord, config::kTraceBufferCapacity> records_{};
+};
+
+namespace details {
+
+/**
+ * @brief Registers the calling thread and returns its buffer, nullptr if no more threads can be registered.
+ */
+TraceBuffer *RegisterCurrentThread() noexcept;
+
+/**
+ * @brief Returns the buffer of the calling thread, registering it on first use.
+ */
+inline TraceBuffer *CurrentBuffer() noexcept {
+  thread_local TraceBuffer *buffer{RegisterCurrentThread()};
+  return buffer;
+}
+
+}  // namespace details
+
+/**
+ * @brief Records a tracepoint of the calling thread.
+ *
+ * Calls are removed by the compiler if the compile time constant daal::af::trace::config::kTracingEnabled is false.
+ */
+inline void Trace(TraceEvent event, std::uint32_t argument = 0) noexcept {
+  if constexpr (config::kTracingEnabled) {
+    TraceBuffer *buffer{details::CurrentBuffer()};
+    if (nullptr != buffer) {
+      buffer->Record(event, argument);
+    }
+  }
+}
+
+/**
+ * @brief Registers the calling thread up front, so its buffer is not allocated on the cycle path.
+ */
+inline void RegisterThread() noexcept {
+  if constexpr (config::kTracingEnabled) {
+    static_cast<void>(details::CurrentBuffer());
+  }
+}
+
+/**
+ * @brief Writes the buffers of all registered threads to a binary file, to be decoded with the trace_dump tool.
+ *
+ * Records written while dumping may be torn, dump while the traced threads are idle for consistent results.
+ *
+ * @param path Path of the file to be written.
+ * @return true if the file was written successfully.
+ */
+bool DumpTraces(const std::string &path);
+
+/**
+ * @brief Returns the name of an event.
+ */
+const char *ToString(TraceEvent event) noexcept;
+
+}  // namespace trace
+}  // namespace af
+}  // namespace daal
+
+#endif  // SRC_DAAL_AF_TRACE_TRACE_H_
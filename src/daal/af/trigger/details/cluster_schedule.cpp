@@ -0,0 +1,161 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "daal/af/trigger/details/cluster_schedule.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <set>
+
+#include "daal/af/trigger/details/daal_steady_clock.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+namespace {
+
+bool IsValid(const ClusterSlot &slot) noexcept {
+  return !slot.name.empty() && slot.name.size() < kClusterSlotNameSize &&
+         slot.name.find('\0') == std::string::npos && slot.period.count() > 0 && slot.offset.count() >= 0 &&
+         slot.offset < slot.period;
+}
+
+std::string_view NameOf(const ClusterSlotRecord &record) noexcept {
+  return std::string_view{record.name.data(), strnlen(record.name.data(), record.name.size())};
+}
+
+}  // namespace
+
+ClusterSchedule::ClusterSchedule(const void *mapping, std::size_t size) noexcept
+    : mapping_{mapping},
+      size_{size},
+      header_{static_cast<const ClusterScheduleHeader *>(mapping)},
+      slots_{reinterpret_cast<const ClusterSlotRecord *>(static_cast<const char *>(mapping) +
+                                                         sizeof(ClusterScheduleHeader))} {}
+
+ClusterSchedule::~ClusterSchedule() { (void)munmap(const_cast<void *>(mapping_), size_); }
+
+bool ClusterSchedule::Write(const std::string &path, const std::vector<ClusterSlot> &slots,
+                            std::optional<std::chrono::steady_clock::time_point> epoch) {
+  if (slots.size() > kMaxClusterSlots) {
+    daal::log::FrameworkLogger::get()->Error("Cluster schedule exceeds {} slots", kMaxClusterSlots);
+    return false;
+  }
+  std::set<std::string> names;
+  std::vector<ClusterSlotRecord> records;
+  records.reserve(slots.size());
+  for (const auto &slot : slots) {
+    if (!IsValid(slot) || !names.insert(slot.name).second) {
+      daal::log::FrameworkLogger::get()->Error("Invalid or duplicate cluster slot '{}'", slot.name);
+      return false;
+    }
+    ClusterSlotRecord record{};
+    std::memcpy(record.name.data(), slot.name.data(), slot.name.size());
+    record.period_ns = slot.period.count();
+    record.offset_ns = slot.offset.count();
+    records.push_back(record);
+  }
+
+  const auto kEpoch = epoch.value_or(DAALSteadyClock::now());
+  const ClusterScheduleHeader kHeader{
+      kClusterScheduleMagic, static_cast<std::uint32_t>(sizeof(ClusterSlotRecord)),
+      static_cast<std::uint32_t>(records.size()),
+      std::chrono::duration_cast<std::chrono::nanoseconds>(kEpoch.time_since_epoch()).count()};
+
+  // Write a temporary file and rename it, readers see either the old or the new schedule
+  const std::string kTemporary{path + ".tmp." + std::to_string(getpid())};
+  std::FILE *file{std::fopen(kTemporary.c_str(), "wb")};
+  if (nullptr == file) {
+    daal::log::FrameworkLogger::get()->Error("Cannot open cluster schedule {}", kTemporary);
+    return false;
+  }
+  bool success{std::fwrite(&kHeader, sizeof(kHeader), 1, file) == 1};
+  if (success && !records.empty()) {
+    success = std::fwrite(records.data(), sizeof(ClusterSlotRecord), records.size(), file) == records.size();
+  }
+  success = (std::fclose(file) == 0) && success;
+  success = success && (std::rename(kTemporary.c_str(), path.c_str()) == 0);
+  if (!success) {
+    (void)std::remove(kTemporary.c_str());
+    daal::log::FrameworkLogger::get()->Error("Writing cluster schedule {} failed", path);
+  }
+  return success;
+}
+
+std::unique_ptr<ClusterSchedule> ClusterSchedule::Open(const std::string &path) {
+  const int kFd{open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+  if (kFd < 0) {
+    daal::log::FrameworkLogger::get()->Error("Cannot open cluster schedule {}", path);
+    return nullptr;
+  }
+  struct stat status {};
+  if (fstat(kFd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(ClusterScheduleHeader)) {
+    (void)close(kFd);
+    daal::log::FrameworkLogger::get()->Error("{} is not a cluster schedule", path);
+    return nullptr;
+  }
+  const auto kSize = static_cast<std::size_t>(status.st_size);
+  void *mapping{mmap(nullptr, kSize, PROT_READ, MAP_SHARED, kFd, 0)};
+  // The mapping stays valid after closing the descriptor
+  (void)close(kFd);
+  if (MAP_FAILED == mapping) {
+    daal::log::FrameworkLogger::get()->Error("Cannot map cluster schedule {}", path);
+    return nullptr;
+  }
+
+  const auto *header = static_cast<const ClusterScheduleHeader *>(mapping);
+  if (header->magic != kClusterScheduleMagic || header->slot_size != sizeof(ClusterSlotRecord) ||
+      header->slot_count > kMaxClusterSlots ||
+      kSize != sizeof(ClusterScheduleHeader) + header->slot_count * sizeof(ClusterSlotRecord)) {
+    (void)munmap(mapping, kSize);
+    daal::log::FrameworkLogger::get()->Error("{} is not a cluster schedule of this version", path);
+    return nullptr;
+  }
+  return std::unique_ptr<ClusterSchedule>{new ClusterSchedule{mapping, kSize}};
+}
+
+std::chrono::steady_clock::time_point ClusterSchedule::GetEpoch() const noexcept {
+  return std::chrono::steady_clock::time_point{std::chrono::nanoseconds{header_->epoch_ns}};
+}
+
+std::size_t ClusterSchedule::Size() const noexcept { return header_->slot_count; }
+
+std::optional<ClusterSlot> ClusterSchedule::FindSlot(std::string_view name) const {
+  for (std::uint32_t idx = 0; idx < header_->slot_count; ++idx) {
+    const ClusterSlotRecord &record{slots_[idx]};
+    if (NameOf(record) == name) {
+      // Files written by other tools are validated when the slot is used
+      if (record.period_ns <= 0 || record.offset_ns < 0 || record.offset_ns >= record.period_ns) {
+        daal::log::FrameworkLogger::get()->Error("Cluster slot '{}' has an invalid timing", name);
+        return std::nullopt;
+      }
+      return ClusterSlot{std::string{name}, std::chrono::nanoseconds{record.period_ns},
+                         std::chrono::nanoseconds{record.offset_ns}, GetEpoch()};
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
@@ -0,0 +1,155 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * @file cluster_schedule.hpp
+ * @brief Contains the ClusterSchedule, a time grid shared by several processes.
+ *
+ * Processes on the same ECU read a common epoch and their slot (period and
+ * offset) from a schedule file. Periodic triggers built from the slots are
+ * phase locked: the offset between a producer and its consumer is fixed by
+ * the schedule instead of depending on which process started first.
+ */
+
+#ifndef SRC_DAAL_AF_TRIGGER_DETAILS_CLUSTER_SCHEDULE_H_
+#define SRC_DAAL_AF_TRIGGER_DETAILS_CLUSTER_SCHEDULE_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+/** Maximum length of a slot name including the terminating zero. */
+constexpr std::size_t kClusterSlotNameSize{32};
+
+/** Maximum number of slots of a schedule. */
+constexpr std::uint32_t kMaxClusterSlots{256};
+
+/**
+ * @brief Header of a schedule file, followed by slot_count ClusterSlotRecords.
+ */
+struct ClusterScheduleHeader {
+  std::array<char, 8> magic;  ///< "DAALSCH1"
+  std::uint32_t slot_size;    ///< Size of a ClusterSlotRecord.
+  std::uint32_t slot_count;   ///< Number of slots following the header.
+  std::int64_t epoch_ns;      ///< Origin of the grid on CLOCK_MONOTONIC [ns].
+};
+
+/**
+ * @brief A slot as stored in the schedule file.
+ */
+struct ClusterSlotRecord {
+  std::array<char, kClusterSlotNameSize> name;  ///< Zero terminated name of the slot.
+  std::int64_t period_ns;
+  std::int64_t offset_ns;
+};
+
+static_assert(sizeof(ClusterScheduleHeader) == 24, "Schedule files are mapped as raw bytes");
+static_assert(sizeof(ClusterSlotRecord) == 48, "Schedule files are mapped as raw bytes");
+
+constexpr std::array<char, 8> kClusterScheduleMagic{'D', 'A', 'A', 'L', 'S', 'C', 'H', '1'};
+
+/**
+ * @brief Activation timing of one process in the cluster.
+ */
+struct ClusterSlot {
+  std::string name;
+  std::chrono::nanoseconds period;
+  std::chrono::nanoseconds offset;             ///< Offset relative to the epoch, less than the period.
+  std::chrono::steady_clock::time_point epoch;  ///< Common origin of all slots.
+};
+
+/**
+ * @class ClusterSchedule
+ * @brief Read-only view of a memory-mapped schedule file.
+ *
+ * The file is written once by Write(), usually by a setup step or the
+ * cluster_schedule tool before the processes start, and is replaced
+ * atomically so readers never see a partial schedule. The epoch is taken from
+ * CLOCK_MONOTONIC, so the file is only meaningful until the next reboot; keep
+ * it on a tmpfs like /dev/shm.
+ *
+ * Usage:
+ * \code
+ * auto schedule = ClusterSchedule::Open("/dev/shm/daal_schedule");
+ * auto slot = schedule->FindSlot("radar_consumer");
+ * PeriodicTrigger trigger{slot->period, slot->offset, slot->epoch};
+ * \endcode
+ */
+class ClusterSchedule {
+ public:
+  ~ClusterSchedule();
+  ClusterSchedule(const ClusterSchedule &) = delete;
+  ClusterSchedule &operator=(const ClusterSchedule &) = delete;
+  ClusterSchedule(ClusterSchedule &&) = delete;
+  ClusterSchedule &operator=(ClusterSchedule &&) = delete;
+
+  /**
+   * @brief Writes a schedule file.
+   *
+   * @param path Path of the file, an existing file is replaced atomically.
+   * @param slots The slots, names must be unique and shorter than
+   * kClusterSlotNameSize, offsets must be smaller than the periods.
+   * @param epoch Origin of the grid, the current time if not given.
+   * @return false if the slots are invalid or the file could not be written.
+   */
+  static bool Write(const std::string &path, const std::vector<ClusterSlot> &slots,
+                    std::optional<std::chrono::steady_clock::time_point> epoch = std::nullopt);
+
+  /**
+   * @brief Maps a schedule file.
+   * @return nullptr if the file cannot be mapped or is not a valid schedule.
+   */
+  static std::unique_ptr<ClusterSchedule> Open(const std::string &path);
+
+  /**
+   * @brief Returns the common origin of all slots.
+   */
+  std::chrono::steady_clock::time_point GetEpoch() const noexcept;
+
+  /**
+   * @brief Returns the number of slots.
+   */
+  std::size_t Size() const noexcept;
+
+  /**
+   * @brief Returns the slot of the given name, std::nullopt if there is none.
+   */
+  std::optional<ClusterSlot> FindSlot(std::string_view name) const;
+
+ private:
+  ClusterSchedule(const void *mapping, std::size_t size) noexcept;
+
+  const void *mapping_;
+  std::size_t size_;
+  const ClusterScheduleHeader *header_;
+  const ClusterSlotRecord *slots_;
+};
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_TRIGGER_DETAILS_CLUSTER_SCHEDULE_H_ */
@@ -20,11 +20,24 @@
 #include <iostream>
 #include <thread>
 
+#include "daal/af/trigger/wait_policy.hpp"
+
 namespace daal {
 
 namespace af {
 namespace trigger {
 
+/**
+ * @brief Hints the CPU that the calling thread is spinning.
+ */
+inline void CpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
 /**
  * @brief A class that provides a static function to get the current time using
  * std::chrono::steady_clock.
@@ -66,6 +79,26 @@ class DAALSteadyClock {
       ret = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &desired_wakeup, NULL);
     } while (ret == EINTR);
   }
+
+  /**
+   * @brief Waits until the time point with the given strategy.
+   */
+  static void sleep_until(const std::chrono::steady_clock::time_point &time_point, const WaitPolicy &policy) {
+    switch (policy.strategy) {
+      case WaitStrategy::kHybrid:
+        sleep_until(time_point - policy.spin_margin);
+        [[fallthrough]];
+      case WaitStrategy::kSpin:
+        while (now() < time_point) {
+          CpuRelax();
+        }
+        break;
+      case WaitStrategy::kSleep:
+      default:
+        sleep_until(time_point);
+        break;
+    }
+  }
 };
 
 }  // namespace trigger
@@ -0,0 +1,49 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "daal/af/trigger/details/event_trigger.hpp"
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+DataReadyCondition::DataReadyCondition(daal::af::sync::DataReadySignal &signal,
+                                       std::chrono::nanoseconds timeout) noexcept
+    : TriggerCondition(), signal_{signal}, timeout_{timeout}, seen_epoch_{signal.GetEpoch()}, notification_count_{0} {}
+
+bool DataReadyCondition::IsTriggered() noexcept {
+  if (!signal_.WaitFor(seen_epoch_, timeout_)) {
+    notification_count_ = 0;
+    return false;
+  }
+  const std::uint32_t kEpoch{signal_.GetEpoch()};
+  notification_count_ = kEpoch - seen_epoch_;
+  seen_epoch_ = kEpoch;
+  return true;
+}
+
+std::uint32_t DataReadyCondition::GetNotificationCount() const noexcept { return notification_count_; }
+
+uint64_t ImmediateActivation::Wait() noexcept { return 0; }
+
+EventTrigger::EventTrigger(daal::af::sync::DataReadySignal &signal, std::chrono::nanoseconds timeout)
+    : SimpleTrigger(activation_, condition_), activation_{}, condition_{signal, timeout} {}
+
+std::uint32_t EventTrigger::GetNotificationCount() const noexcept { return condition_.GetNotificationCount(); }
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
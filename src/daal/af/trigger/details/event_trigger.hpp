@@ -0,0 +1,146 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * @file event_trigger.hpp
+ * @brief Contains the event driven trigger.
+ *
+ * The EventTrigger activates a cycle as soon as new data was announced through
+ * a DataReadySignal instead of waiting for the next period. A timeout keeps
+ * the cycle running if the data sources fall silent.
+ */
+
+#ifndef SRC_DAAL_AF_TRIGGER_DETAILS_EVENT_TRIGGER_H_
+#define SRC_DAAL_AF_TRIGGER_DETAILS_EVENT_TRIGGER_H_
+
+#include <chrono>
+#include <cstdint>
+
+#include "daal/af/sync/data_ready_signal.hpp"
+#include "daal/af/trigger/details/trigger_impl.hpp"
+#include "daal/af/trigger/trigger_activation.hpp"
+#include "daal/af/trigger/trigger_condition.hpp"
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+/**
+ * @class DataReadyCondition
+ * @brief Trigger condition that blocks until new data arrived.
+ *
+ * IsTriggered() returns as soon as the signal was notified since the previous
+ * call, immediately if that happened already while the cycle was running.
+ * Notifications in between are coalesced into one activation.
+ */
+class DataReadyCondition : public TriggerCondition {
+ public:
+  /**
+   * @brief Constructs the condition.
+   * @param signal The signal notified by the data sources.
+   * @param timeout Maximum time to wait for new data.
+   */
+  DataReadyCondition(daal::af::sync::DataReadySignal &signal, std::chrono::nanoseconds timeout) noexcept;
+  ~DataReadyCondition() override = default;
+
+  DataReadyCondition(const DataReadyCondition &) = delete;
+  auto operator=(const DataReadyCondition &) -> DataReadyCondition & = delete;
+  DataReadyCondition(DataReadyCondition &&) = delete;
+  auto operator=(DataReadyCondition &&) -> DataReadyCondition & = delete;
+
+  /**
+   * @brief Waits for new data.
+   * @return true if new data arrived, false if the timeout expired.
+   */
+  auto IsTriggered() noexcept -> bool override;
+
+  /**
+   * @brief Number of notifications handled by the last activation, more than
+   * one if samples arrived faster than the cycle ran.
+   */
+  auto GetNotificationCount() const noexcept -> std::uint32_t;
+
+ private:
+  daal::af::sync::DataReadySignal &signal_;
+  std::chrono::nanoseconds timeout_;
+  std::uint32_t seen_epoch_;
+  std::uint32_t notification_count_;
+};
+
+/**
+ * @class ImmediateActivation
+ * @brief Activation that does not wait, the cycle starts as soon as the
+ * condition allowed it.
+ */
+class ImmediateActivation : public TriggerActivation {
+ public:
+  ImmediateActivation() = default;
+  ~ImmediateActivation() override = default;
+
+  ImmediateActivation(const ImmediateActivation &) = default;
+  auto operator=(const ImmediateActivation &) -> ImmediateActivation & = default;
+  ImmediateActivation(ImmediateActivation &&) = default;
+  auto operator=(ImmediateActivation &&) -> ImmediateActivation & = default;
+
+  /**
+   * @brief Returns immediately.
+   * @return Always 0, there is no schedule to miss.
+   */
+  auto Wait() noexcept -> uint64_t override;
+};
+
+/**
+ * @class EventTrigger
+ * @brief Trigger that activates a cycle when new data arrived.
+ *
+ * The data sources, usually IoHandlers connected with
+ * IoHandler::SetDataReadySignal(), notify the signal whenever they received a
+ * sample. CheckTriggerConditionAndWait() returns true right after that, and
+ * false if nothing arrived within the timeout, so the cycle still runs
+ * periodically while the inputs are silent.
+ */
+class EventTrigger : public SimpleTrigger {
+ public:
+  /**
+   * @brief Constructs an EventTrigger.
+   * @param signal The signal notified by the data sources, must outlive the
+   * trigger.
+   * @param timeout Maximum time between two activations.
+   */
+  EventTrigger(daal::af::sync::DataReadySignal &signal, std::chrono::nanoseconds timeout);
+
+  ~EventTrigger() override = default;
+
+  EventTrigger(const EventTrigger &) = delete;
+  EventTrigger &operator=(const EventTrigger &) & = delete;
+  EventTrigger(EventTrigger &&) = delete;
+  EventTrigger &operator=(EventTrigger &&) & = delete;
+
+  /**
+   * @brief Number of notifications coalesced into the last activation.
+   */
+  auto GetNotificationCount() const noexcept -> std::uint32_t;
+
+ private:
+  ImmediateActivation activation_; /**< Starts the cycle without delay. */
+  DataReadyCondition condition_;   /**< Waits for the data sources. */
+};
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_TRIGGER_DETAILS_EVENT_TRIGGER_H_ */
@@ -0,0 +1,159 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "daal/af/trigger/details/hybrid_trigger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+#include "daal/af/trigger/details/daal_steady_clock.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+HybridTrigger::HybridTrigger(daal::af::sync::DataReadySignal &group, std::vector<Input> inputs, std::size_t required,
+                             std::chrono::nanoseconds period, std::chrono::nanoseconds max_latency)
+    : Trigger(),
+      group_{group},
+      inputs_{std::move(inputs)},
+      seen_epochs_{},
+      required_{required},
+      period_{period},
+      max_latency_{max_latency},
+      next_period_{},
+      first_arrival_{},
+      has_arrival_{false},
+      initialized_{false},
+      cause_{WakeupCause::kNone},
+      ready_inputs_{0},
+      status_{} {
+  if (period_.count() <= 0 || max_latency_.count() <= 0) {
+    daal::log::FrameworkLogger::get()->Error("Period and maximum latency must be positive");
+    exit(42);
+  }
+  if (required_ == 0 || required_ > inputs_.size()) {
+    daal::log::FrameworkLogger::get()->Error("Required inputs {} out of range [1, {}]", required_, inputs_.size());
+    exit(42);
+  }
+  for (const auto &input : inputs_) {
+    if (input.get().GetGroup() != &group_) {
+      daal::log::FrameworkLogger::get()->Error("Input of the hybrid trigger does not notify its group");
+      exit(42);
+    }
+    seen_epochs_.push_back(input.get().GetEpoch());
+  }
+}
+
+std::size_t HybridTrigger::CountReadyInputs() const noexcept {
+  std::size_t ready{0};
+  for (std::size_t idx = 0; idx < inputs_.size(); ++idx) {
+    if (inputs_[idx].get().GetEpoch() != seen_epochs_[idx]) {
+      ++ready;
+    }
+  }
+  return ready;
+}
+
+bool HybridTrigger::CheckTriggerConditionAndWait() {
+  if (!initialized_) {
+    // Same global time slot as PeriodicActivation
+    const auto kNow = DAALSteadyClock::now();
+    next_period_ = kNow + (period_ - (kNow.time_since_epoch() % period_));
+    initialized_ = true;
+  }
+
+  std::chrono::steady_clock::time_point now{};
+  while (true) {
+    // Read the group first, an input notified after this is seen by the wait below
+    const std::uint32_t kGroupEpoch{group_.GetEpoch()};
+    ready_inputs_ = CountReadyInputs();
+    now = DAALSteadyClock::now();
+    if (ready_inputs_ >= required_) {
+      cause_ = WakeupCause::kDataReady;
+      break;
+    }
+    if (ready_inputs_ != 0 && !has_arrival_) {
+      first_arrival_ = now;
+      has_arrival_ = true;
+    }
+    if (now >= next_period_) {
+      cause_ = WakeupCause::kPeriod;
+      break;
+    }
+    if (has_arrival_ && now >= first_arrival_ + max_latency_) {
+      cause_ = WakeupCause::kTimeout;
+      break;
+    }
+    const auto kDeadline = has_arrival_ ? std::min(next_period_, first_arrival_ + max_latency_) : next_period_;
+    (void)group_.WaitUntil(kGroupEpoch, kDeadline);
+  }
+
+  // Consume the data of all inputs
+  for (std::size_t idx = 0; idx < inputs_.size(); ++idx) {
+    seen_epochs_[idx] = inputs_[idx].get().GetEpoch();
+  }
+  has_arrival_ = false;
+
+  // A boundary that passed is served by this activation, whatever caused it
+  status_ = ActivationStatus{};
+  if (now >= next_period_) {
+    const auto kLate = std::chrono::duration_cast<std::chrono::nanoseconds>(now - next_period_);
+    status_.missed_cycles = static_cast<std::uint64_t>(kLate.count() / period_.count());
+    if (cause_ == WakeupCause::kPeriod) {
+      status_.wakeup_jitter = kLate % period_;
+    }
+    next_period_ += (status_.missed_cycles + 1) * period_;
+  }
+  return true;
+}
+
+ActivationStatus HybridTrigger::GetActivationStatus() const { return status_; }
+
+bool HybridTrigger::SetPeriod(std::chrono::nanoseconds period) {
+  if (period.count() <= 0) {
+    return false;
+  }
+  period_ = period;
+  return true;
+}
+
+std::chrono::nanoseconds HybridTrigger::GetPeriod() const { return period_; }
+
+WakeupCause HybridTrigger::GetWakeupCause() const noexcept { return cause_; }
+
+std::size_t HybridTrigger::GetReadyInputCount() const noexcept { return ready_inputs_; }
+
+const char *ToString(WakeupCause cause) noexcept {
+  switch (cause) {
+    case WakeupCause::kNone:
+      return "none";
+    case WakeupCause::kDataReady:
+      return "data_ready";
+    case WakeupCause::kPeriod:
+      return "period";
+    case WakeupCause::kTimeout:
+      return "timeout";
+    default:
+      return "unknown";
+  }
+}
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
@@ -0,0 +1,156 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * @file hybrid_trigger.hpp
+ * @brief Contains the HybridTrigger class.
+ *
+ * The HybridTrigger combines a periodic activation with a data-ready condition
+ * over several inputs, e.g. for sensor fusion: the cycle runs as soon as the
+ * required inputs delivered new data, but never less often than the period.
+ */
+
+#ifndef SRC_DAAL_AF_TRIGGER_DETAILS_HYBRID_TRIGGER_H_
+#define SRC_DAAL_AF_TRIGGER_DETAILS_HYBRID_TRIGGER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "daal/af/sync/data_ready_signal.hpp"
+#include "daal/af/trigger/trigger.hpp"
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+/**
+ * @brief Reason of the last activation of a HybridTrigger.
+ */
+enum class WakeupCause : std::uint8_t {
+  kNone = 0,       ///< The trigger was not activated yet.
+  kDataReady = 1,  ///< The required number of inputs delivered new data.
+  kPeriod = 2,     ///< The period boundary was reached.
+  kTimeout = 3,    ///< Some inputs delivered data, the others did not within the maximum latency.
+};
+
+/**
+ * @class HybridTrigger
+ * @brief Trigger activated at the earliest of N-of-M inputs ready, the period
+ * boundary or a maximum latency after the first input arrived.
+ *
+ * Every input is a DataReadySignal of the same group, the trigger blocks on the
+ * group and counts the inputs whose epoch moved on since the last activation.
+ * Period boundaries lie on the global time grid like the ones of
+ * PeriodicActivation; an activation caused by data does not move the grid.
+ * Boundaries passed while the cycle was running are reported as missed cycles.
+ * Each activation consumes the data of all inputs, ready or not.
+ *
+ * The maximum latency bounds how long data of a single input waits for the
+ * others. It starts when the trigger first sees an input with new data.
+ */
+class HybridTrigger : public Trigger {
+ public:
+  using Input = std::reference_wrapper<const daal::af::sync::DataReadySignal>;
+
+  /**
+   * @brief Constructs a HybridTrigger.
+   *
+   * The program exits if the configuration is invalid.
+   *
+   * @param group Signal all inputs forward their notifications to.
+   * @param inputs The inputs, all of them constructed with group.
+   * @param required Number of inputs with new data that activate the trigger,
+   * between 1 and the number of inputs.
+   * @param period Maximum time between two activations.
+   * @param max_latency Maximum time data of an input waits for the other ones.
+   */
+  HybridTrigger(daal::af::sync::DataReadySignal &group, std::vector<Input> inputs, std::size_t required,
+                std::chrono::nanoseconds period, std::chrono::nanoseconds max_latency);
+
+  ~HybridTrigger() override = default;
+
+  HybridTrigger(const HybridTrigger &) = delete;
+  HybridTrigger &operator=(const HybridTrigger &) & = delete;
+  HybridTrigger(HybridTrigger &&) = delete;
+  HybridTrigger &operator=(HybridTrigger &&) & = delete;
+
+  /**
+   * @brief Waits for the next activation.
+   * @return Always true, every wake-up activates the cycle.
+   */
+  auto CheckTriggerConditionAndWait() -> bool override;
+
+  /**
+   * @brief Returns the missed period boundaries and the jitter of the last
+   * activation; the jitter is only reported for activations by the period.
+   */
+  auto GetActivationStatus() const -> ActivationStatus override;
+
+  /**
+   * @brief Changes the period, the boundary already scheduled keeps its time.
+   */
+  auto SetPeriod(std::chrono::nanoseconds period) -> bool override;
+
+  /**
+   * @brief Returns the current period.
+   */
+  auto GetPeriod() const -> std::chrono::nanoseconds override;
+
+  /**
+   * @brief Returns which condition caused the last activation.
+   */
+  auto GetWakeupCause() const noexcept -> WakeupCause;
+
+  /**
+   * @brief Returns the number of inputs that had new data at the last
+   * activation.
+   */
+  auto GetReadyInputCount() const noexcept -> std::size_t;
+
+ private:
+  /**
+   * @brief Counts the inputs with new data since the last activation.
+   */
+  std::size_t CountReadyInputs() const noexcept;
+
+  daal::af::sync::DataReadySignal &group_;
+  std::vector<Input> inputs_;
+  std::vector<std::uint32_t> seen_epochs_;  ///< Epoch of every input at the last activation.
+  std::size_t required_;
+  std::chrono::nanoseconds period_;
+  std::chrono::nanoseconds max_latency_;
+  std::chrono::steady_clock::time_point next_period_;
+  std::chrono::steady_clock::time_point first_arrival_;
+  bool has_arrival_;
+  bool initialized_;
+  WakeupCause cause_;
+  std::size_t ready_inputs_;
+  ActivationStatus status_;
+};
+
+/**
+ * @brief Returns the name of a wake-up cause.
+ */
+const char *ToString(WakeupCause cause) noexcept;
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_TRIGGER_DETAILS_HYBRID_TRIGGER_H_ */
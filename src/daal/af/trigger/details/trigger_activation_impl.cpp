@@ -24,19 +24,33 @@ namespace daal {
 namespace af {
 namespace trigger {
 
-PeriodicActivation::PeriodicActivation(std::chrono::nanoseconds period, std::chrono::nanoseconds offset)
-    : period_{period}, offset_{offset}, missed_cycles_{0}, initialized_{false} {
+PeriodicActivation::PeriodicActivation(std::chrono::nanoseconds period, std::chrono::nanoseconds offset,
+                                       WaitPolicy wait_policy, std::chrono::steady_clock::time_point epoch)
+    : period_{period},
+      offset_{offset},
+      wait_policy_{wait_policy},
+      epoch_{epoch},
+      missed_cycles_{0},
+      wakeup_jitter_{0},
+      initialized_{false} {
   if (period_.count() <= 0 || offset_.count() < 0) {
     daal::log::FrameworkLogger::get()->Error("Period cannot be negative or zero / offset can not be negative");
     exit(42);
   }
+  if (wait_policy_.spin_margin.count() < 0) {
+    daal::log::FrameworkLogger::get()->Error("Spin margin can not be negative");
+    exit(42);
+  }
 }
 
 auto PeriodicActivation::Wait() -> uint64_t {
   if (!initialized_) {
     auto time_now = DAALSteadyClock::now();
-    // For the first cycle, pick the global time slot
-    auto global_start = time_now + (period_ - (time_now.time_since_epoch() % period_));
+    // For the first cycle, pick the global time slot following the epoch
+    auto global_start = epoch_;
+    if (time_now >= epoch_) {
+      global_start = time_now + (period_ - ((time_now - epoch_) % period_));
+    }
     // introduce the offset for picking precise start point relative to global
     // time slot
     next_execution_time_ = global_start + offset_;
@@ -44,15 +58,19 @@ auto PeriodicActivation::Wait() -> uint64_t {
   }
 
   // Wait for until it is time for execute
-  DAALSteadyClock::sleep_until(next_execution_time_);
+  DAALSteadyClock::sleep_until(next_execution_time_, wait_policy_);
 
   // Get actual wakeup time
   auto time_now = DAALSteadyClock::now();
 
   // Check if we have missed calls
   missed_cycles_ = 0;
+  wakeup_jitter_ = std::chrono::nanoseconds{0};
   if (time_now > next_execution_time_) {
-    missed_cycles_ = static_cast<uint64_t>((time_now - next_execution_time_).count() / period_.count());
+    const auto kLate = std::chrono::duration_cast<std::chrono::nanoseconds>(time_now - next_execution_time_);
+    missed_cycles_ = static_cast<uint64_t>(kLate.count() / period_.count());
+    // Jitter relative to the time slot that is served now
+    wakeup_jitter_ = kLate % period_;
   }
 
   // Forecast to next time point
@@ -61,6 +79,18 @@ auto PeriodicActivation::Wait() -> uint64_t {
   return missed_cycles_;
 }
 
+auto PeriodicActivation::GetWakeUpJitter() const -> std::chrono::nanoseconds { return wakeup_jitter_; }
+
+auto PeriodicActivation::SetPeriod(std::chrono::nanoseconds period) -> bool {
+  if (period.count() <= 0) {
+    return false;
+  }
+  period_ = period;
+  return true;
+}
+
+auto PeriodicActivation::GetPeriod() const -> std::chrono::nanoseconds { return period_; }
+
 }  // namespace trigger
 
 }  // namespace af
@@ -18,6 +18,7 @@
 #include <cstdint>
 
 #include "daal/af/trigger/trigger_activation.hpp"
+#include "daal/af/trigger/wait_policy.hpp"
 
 namespace daal {
 
@@ -35,9 +36,16 @@ class PeriodicActivation : public TriggerActivation {
   /**
    * @brief Constructs a PeriodicActivation object with the specified period.
    * @param period The period at which the activation occurs.
+   * @param offset Offset of the activation relative to the global time slot.
+   * @param wait_policy How to wait for the activation time.
+   * @param epoch Origin of the time grid. Processes sharing the epoch, e.g.
+   * from a ClusterSchedule, are phase locked independent of their period and
+   * start time. The default aligns to the zero point of the steady clock.
    */
   explicit PeriodicActivation(std::chrono::nanoseconds period,
-                              std::chrono::nanoseconds offset = std::chrono::nanoseconds(0));
+                              std::chrono::nanoseconds offset = std::chrono::nanoseconds(0),
+                              WaitPolicy wait_policy = WaitPolicy{},
+                              std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::time_point{});
 
   /**
    * @brief Default constructor.
@@ -74,11 +82,30 @@ class PeriodicActivation : public TriggerActivation {
    */
   auto Wait() -> uint64_t override;
 
+  /**
+   * @brief Delay of the last wake-up behind the scheduled time slot it serves.
+   */
+  auto GetWakeUpJitter() const -> std::chrono::nanoseconds override;
+
+  /**
+   * @brief Changes the period, the activation already scheduled keeps its time.
+   * @return false if the period is not positive.
+   */
+  auto SetPeriod(std::chrono::nanoseconds period) -> bool;
+
+  /**
+   * @brief Returns the current period.
+   */
+  auto GetPeriod() const -> std::chrono::nanoseconds;
+
  private:
   std::chrono::nanoseconds period_;
   std::chrono::nanoseconds offset_;
+  WaitPolicy wait_policy_;
+  std::chrono::steady_clock::time_point epoch_;
   std::chrono::steady_clock::time_point next_execution_time_;
   uint64_t missed_cycles_;
+  std::chrono::nanoseconds wakeup_jitter_;
   bool initialized_;
 };
 
@@ -19,19 +19,33 @@ namespace af {
 namespace trigger {
 
 SimpleTrigger::SimpleTrigger(TriggerActivation &trigger_activation, TriggerCondition &trigger_condition) noexcept
-    : Trigger(), trigger_activation_{trigger_activation}, trigger_condition_{trigger_condition} {}
+    : Trigger(), trigger_activation_{trigger_activation}, trigger_condition_{trigger_condition}, status_{} {}
 
 bool SimpleTrigger::CheckTriggerConditionAndWait() {
   if (trigger_condition_.IsTriggered()) {
-    (void)trigger_activation_.Wait();
+    status_.missed_cycles = trigger_activation_.Wait();
+    status_.wakeup_jitter = trigger_activation_.GetWakeUpJitter();
     return true;
   }
 
+  status_ = ActivationStatus{};
   return false;
 }
 
-PeriodicTrigger::PeriodicTrigger(std::chrono::nanoseconds period)
-    : SimpleTrigger(activation_, condition_), activation_{period}, condition_{} {}
+ActivationStatus SimpleTrigger::GetActivationStatus() const { return status_; }
+
+PeriodicTrigger::PeriodicTrigger(std::chrono::nanoseconds period, WaitPolicy wait_policy)
+    : SimpleTrigger(activation_, condition_),
+      activation_{period, std::chrono::nanoseconds{0}, wait_policy},
+      condition_{} {}
+
+PeriodicTrigger::PeriodicTrigger(std::chrono::nanoseconds period, std::chrono::nanoseconds offset,
+                                 std::chrono::steady_clock::time_point epoch, WaitPolicy wait_policy)
+    : SimpleTrigger(activation_, condition_), activation_{period, offset, wait_policy, epoch}, condition_{} {}
+
+bool PeriodicTrigger::SetPeriod(std::chrono::nanoseconds period) { return activation_.SetPeriod(period); }
+
+std::chrono::nanoseconds PeriodicTrigger::GetPeriod() const { return activation_.GetPeriod(); }
 
 }  // namespace trigger
 
@@ -31,6 +31,7 @@
 #include "daal/af/trigger/trigger.hpp"
 #include "daal/af/trigger/trigger_activation.hpp"
 #include "daal/af/trigger/trigger_condition.hpp"
+#include "daal/af/trigger/wait_policy.hpp"
 
 namespace daal {
 
@@ -76,9 +77,16 @@ class SimpleTrigger : public Trigger {
    */
   auto CheckTriggerConditionAndWait() -> bool override;
 
+  /**
+   * @brief Returns the missed cycles and the wake-up jitter of the last
+   * activation, zero if the condition was not met.
+   */
+  auto GetActivationStatus() const -> ActivationStatus override;
+
  private:
   TriggerActivation &trigger_activation_; /**< The trigger activation object. */
   TriggerCondition &trigger_condition_;   /**< The trigger condition object. */
+  ActivationStatus status_;               /**< Timing of the last activation. */
 };
 
 /**
@@ -95,11 +103,34 @@ class PeriodicTrigger : public SimpleTrigger {
   /**
    * @brief Constructs a PeriodicTrigger object with the specified period.
    * @param period The period at which the trigger condition should be checked.
+   * @param wait_policy How to wait for the period boundary, kHybrid reduces
+   * the wake-up jitter of short periods.
+   */
+  explicit PeriodicTrigger(std::chrono::nanoseconds period, WaitPolicy wait_policy = WaitPolicy{});
+
+  /**
+   * @brief Constructs a PeriodicTrigger on an explicit time grid.
+   * @param period The period at which the trigger condition should be checked.
+   * @param offset Offset of the activations relative to the grid.
+   * @param epoch Origin of the grid, e.g. the epoch of a ClusterSchedule.
+   * @param wait_policy How to wait for the period boundary.
    */
-  explicit PeriodicTrigger(std::chrono::nanoseconds period);
+  PeriodicTrigger(std::chrono::nanoseconds period, std::chrono::nanoseconds offset,
+                  std::chrono::steady_clock::time_point epoch, WaitPolicy wait_policy = WaitPolicy{});
 
   ~PeriodicTrigger() override = default;
 
+  /**
+   * @brief Changes the period, the grid continues from the activation already
+   * scheduled.
+   */
+  auto SetPeriod(std::chrono::nanoseconds period) -> bool override;
+
+  /**
+   * @brief Returns the current period.
+   */
+  auto GetPeriod() const -> std::chrono::nanoseconds override;
+
  protected:
   PeriodicTrigger(const PeriodicTrigger &) = default;
   PeriodicTrigger &operator=(const PeriodicTrigger &) & = default;
@@ -0,0 +1,77 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * Writes a cluster schedule file read by daal::af::trigger::ClusterSchedule.
+ *
+ * Usage: cluster_schedule <schedule file> <name>:<period [us]>:<offset [us]>...
+ *
+ * The epoch of the schedule is the current time. Run it once before the
+ * processes of the cluster start, e.g.
+ *   cluster_schedule /dev/shm/daal_schedule radar:10000:0 fusion:10000:2500
+ */
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "daal/af/trigger/details/cluster_schedule.hpp"
+
+namespace {
+
+bool Parse(const std::string &argument, daal::af::trigger::ClusterSlot &slot) {
+  const auto kFirst = argument.find(':');
+  const auto kSecond = argument.find(':', kFirst == std::string::npos ? kFirst : kFirst + 1);
+  if (kFirst == std::string::npos || kSecond == std::string::npos) {
+    return false;
+  }
+  char *end{nullptr};
+  const long long kPeriod{std::strtoll(argument.c_str() + kFirst + 1, &end, 10)};
+  if (end != argument.c_str() + kSecond) {
+    return false;
+  }
+  const long long kOffset{std::strtoll(argument.c_str() + kSecond + 1, &end, 10)};
+  if (*end != '\0' || end == argument.c_str() + kSecond + 1) {
+    return false;
+  }
+  slot.name = argument.substr(0, kFirst);
+  slot.period = std::chrono::microseconds{kPeriod};
+  slot.offset = std::chrono::microseconds{kOffset};
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fmt::print(stderr, "Usage: {} <schedule file> <name>:<period [us]>:<offset [us]>...\n", argv[0]);
+    return 1;
+  }
+  std::vector<daal::af::trigger::ClusterSlot> slots;
+  for (int arg = 2; arg < argc; ++arg) {
+    daal::af::trigger::ClusterSlot slot{};
+    if (!Parse(argv[arg], slot)) {
+      fmt::print(stderr, "Cannot parse slot {}\n", argv[arg]);
+      return 1;
+    }
+    slots.push_back(slot);
+  }
+  if (!daal::af::trigger::ClusterSchedule::Write(argv[1], slots)) {
+    return 1;
+  }
+  fmt::print("Wrote {} slots to {}\n", slots.size(), argv[1]);
+  return 0;
+}
@@ -24,11 +24,22 @@
 #ifndef APPLICATION_COMMON_DAAL_SAFE_RUNNER_TRIGGER_TRIGGER_H_
 #define APPLICATION_COMMON_DAAL_SAFE_RUNNER_TRIGGER_TRIGGER_H_
 
+#include <chrono>
+#include <cstdint>
+
 namespace daal {
 
 namespace af {
 namespace trigger {
 
+/**
+ * @brief Timing of the last activation of a trigger.
+ */
+struct ActivationStatus {
+  std::uint64_t missed_cycles{0};             ///< Activations skipped since the previous one.
+  std::chrono::nanoseconds wakeup_jitter{0};  ///< Delay behind the scheduled activation time.
+};
+
 class Trigger {
  public:
   /**
@@ -68,6 +79,29 @@ class Trigger {
    * This function is pure virtual and must be implemented by derived classes.
    */
   virtual bool CheckTriggerConditionAndWait() = 0;
+
+  /**
+   * @brief Returns the timing of the last activation.
+   *
+   * Triggers without a schedule report neither missed cycles nor jitter.
+   */
+  virtual ActivationStatus GetActivationStatus() const { return ActivationStatus{}; }
+
+  /**
+   * @brief Changes the period of a periodic trigger, e.g. to stretch it while
+   * the system is degraded. The new period applies from the next activation.
+   *
+   * @return false if the trigger has no period or the period is invalid.
+   */
+  virtual bool SetPeriod(std::chrono::nanoseconds period) {
+    static_cast<void>(period);
+    return false;
+  }
+
+  /**
+   * @brief Returns the current period, zero for triggers without a period.
+   */
+  virtual std::chrono::nanoseconds GetPeriod() const { return std::chrono::nanoseconds{0}; }
 };
 
 }  // namespace trigger
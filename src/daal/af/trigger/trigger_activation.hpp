@@ -11,6 +11,7 @@
 * SPDX-License-Identifier: Apache-2.0
 ********************************************************************************/
 
+#include <chrono>
 #include <cstdint>
 
 /**
@@ -75,6 +76,12 @@ class TriggerActivation {
    * @return missed calls.
    */
   virtual auto Wait() -> uint64_t = 0;
+
+  /**
+   * @brief Delay of the last wake-up behind its scheduled time.
+   * @return zero for activations without a schedule.
+   */
+  virtual auto GetWakeUpJitter() const -> std::chrono::nanoseconds { return std::chrono::nanoseconds{0}; }
 };
 
 }  // namespace trigger
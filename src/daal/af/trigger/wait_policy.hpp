@@ -0,0 +1,58 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * @file wait_policy.hpp
+ * @brief Defines how triggers wait for their activation time.
+ */
+
+#ifndef SRC_DAAL_AF_TRIGGER_WAIT_POLICY_H_
+#define SRC_DAAL_AF_TRIGGER_WAIT_POLICY_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace daal {
+
+namespace af {
+namespace trigger {
+
+/**
+ * @brief Strategy of waiting for an absolute point in time.
+ */
+enum class WaitStrategy : std::uint8_t {
+  kSleep = 0,   ///< Sleep until the time point, the wake-up latency of the kernel adds to the jitter.
+  kSpin = 1,    ///< Poll the clock until the time point, occupies the core for the whole wait.
+  kHybrid = 2,  ///< Sleep until the time point minus a margin, then poll the clock for the rest.
+};
+
+/**
+ * @brief Wait strategy of a trigger.
+ *
+ * kHybrid trades a short busy phase per activation for a wake-up jitter close
+ * to the clock resolution. The margin should cover the usual wake-up latency
+ * of the system, typically 50 to 100 µs on a loaded kernel without real time
+ * patches.
+ */
+struct WaitPolicy {
+  WaitStrategy strategy{WaitStrategy::kSleep};
+  std::chrono::nanoseconds spin_margin{std::chrono::microseconds{100}};  ///< Busy phase of kHybrid.
+};
+
+}  // namespace trigger
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_TRIGGER_WAIT_POLICY_H_ */
@@ -0,0 +1,300 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "task_graph.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <utility>
+
+#include "daal/af/sync/atomic_wait.hpp"
+#include "daal/af/trace/trace.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace worker {
+
+namespace {
+/** Number of polls before an idle executor goes to sleep. */
+constexpr std::uint32_t kSpinCount{2000};
+}  // namespace
+
+void TaskGraph::ReadyQueue::Reserve(std::size_t capacity) {
+  slots_ = std::make_unique<std::atomic<NodeId>[]>(capacity);
+  capacity_ = capacity;
+  Reset();
+}
+
+void TaskGraph::ReadyQueue::Reset() noexcept {
+  for (std::size_t idx = 0; idx < capacity_; ++idx) {
+    slots_[idx].store(kNoNode, std::memory_order_relaxed);
+  }
+  head_.store(0, std::memory_order_relaxed);
+  tail_.store(0, std::memory_order_relaxed);
+}
+
+void TaskGraph::ReadyQueue::Push(NodeId node) noexcept {
+  const std::uint32_t kSlot{tail_.fetch_add(1, std::memory_order_acq_rel)};
+  slots_[kSlot].store(node, std::memory_order_release);
+}
+
+TaskGraph::NodeId TaskGraph::ReadyQueue::TryPop() noexcept {
+  std::uint32_t head{head_.load(std::memory_order_relaxed)};
+  while (head < tail_.load(std::memory_order_acquire)) {
+    if (head_.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+      // The slot is reserved by the producer already, it is published shortly
+      NodeId node{slots_[head].load(std::memory_order_acquire)};
+      while (node == kNoNode) {
+        node = slots_[head].load(std::memory_order_acquire);
+      }
+      return node;
+    }
+  }
+  return kNoNode;
+}
+
+bool TaskGraph::ReadyQueue::IsEmpty() const noexcept {
+  return head_.load(std::memory_order_relaxed) >= tail_.load(std::memory_order_acquire);
+}
+
+TaskGraph::TaskGraph(std::size_t worker_count)
+    : worker_count_{worker_count},
+      finalized_{false},
+      tasks_{},
+      executors_{},
+      edges_{},
+      successor_offsets_{},
+      successors_{},
+      predecessor_counts_{},
+      node_queues_{},
+      topological_order_{},
+      roots_{},
+      pending_{},
+      queues_{},
+      state_{std::make_unique<ExecutionState>()} {}
+
+TaskGraph::NodeId TaskGraph::AddNode(Task task, std::size_t executor) {
+  if (finalized_) {
+    daal::log::FrameworkLogger::get()->Error("Task graph is finalized already");
+    std::abort();
+  }
+  tasks_.push_back(std::move(task));
+  executors_.push_back(executor);
+  return static_cast<NodeId>(tasks_.size() - 1);
+}
+
+bool TaskGraph::AddDependency(NodeId before, NodeId after) {
+  if (finalized_ || before >= tasks_.size() || after >= tasks_.size() || before == after) {
+    return false;
+  }
+  edges_.emplace_back(before, after);
+  return true;
+}
+
+bool TaskGraph::IsFinalized() const noexcept { return finalized_; }
+
+std::size_t TaskGraph::Size() const noexcept { return tasks_.size(); }
+
+const std::vector<TaskGraph::NodeId> &TaskGraph::TopologicalOrder() const noexcept { return topological_order_; }
+
+std::size_t TaskGraph::QueueOf(std::size_t executor) const noexcept {
+  if (executor == kMainThread || (executor == WorkerPool::kAnyWorker && worker_count_ == 0)) {
+    return worker_count_;
+  }
+  if (executor == WorkerPool::kAnyWorker) {
+    return worker_count_ + 1;
+  }
+  return executor;
+}
+
+bool TaskGraph::Finalize() {
+  if (finalized_) {
+    return true;
+  }
+  const std::size_t kNodeCount{tasks_.size()};
+  for (std::size_t node = 0; node < kNodeCount; ++node) {
+    const std::size_t kExecutor{executors_[node]};
+    if (kExecutor != kMainThread && kExecutor != WorkerPool::kAnyWorker && kExecutor >= worker_count_) {
+      daal::log::FrameworkLogger::get()->Error("Task graph node {} bound to invalid worker {}", node, kExecutor);
+      return false;
+    }
+  }
+
+  // Successor lists as one flat array (compressed sparse rows)
+  successor_offsets_.assign(kNodeCount + 1, 0);
+  predecessor_counts_.assign(kNodeCount, 0);
+  for (const auto &edge : edges_) {
+    ++successor_offsets_[edge.first + 1];
+    ++predecessor_counts_[edge.second];
+  }
+  for (std::size_t node = 0; node < kNodeCount; ++node) {
+    successor_offsets_[node + 1] += successor_offsets_[node];
+  }
+  successors_.assign(edges_.size(), kNoNode);
+  std::vector<std::uint32_t> fill(successor_offsets_.begin(), successor_offsets_.end() - 1);
+  for (const auto &edge : edges_) {
+    successors_[fill[edge.first]++] = edge.second;
+  }
+
+  // Kahn's algorithm, ready nodes ordered by id for a deterministic order
+  std::vector<std::uint32_t> in_degree{predecessor_counts_};
+  std::priority_queue<NodeId, std::vector<NodeId>, std::greater<NodeId>> ready;
+  roots_.clear();
+  for (NodeId node = 0; node < kNodeCount; ++node) {
+    if (in_degree[node] == 0) {
+      ready.push(node);
+      roots_.push_back(node);
+    }
+  }
+  topological_order_.clear();
+  topological_order_.reserve(kNodeCount);
+  while (!ready.empty()) {
+    const NodeId kNode{ready.top()};
+    ready.pop();
+    topological_order_.push_back(kNode);
+    for (std::uint32_t idx = successor_offsets_[kNode]; idx < successor_offsets_[kNode + 1]; ++idx) {
+      if (--in_degree[successors_[idx]] == 0) {
+        ready.push(successors_[idx]);
+      }
+    }
+  }
+  if (topological_order_.size() != kNodeCount) {
+    daal::log::FrameworkLogger::get()->Error("Task graph contains a cycle");
+    topological_order_.clear();
+    return false;
+  }
+
+  // Queues sized for the worst case, every node is pushed once per execution
+  const std::size_t kQueueCount{worker_count_ + 2};
+  std::vector<std::size_t> queue_sizes(kQueueCount, 0);
+  node_queues_.resize(kNodeCount);
+  for (std::size_t node = 0; node < kNodeCount; ++node) {
+    node_queues_[node] = static_cast<std::uint32_t>(QueueOf(executors_[node]));
+    ++queue_sizes[node_queues_[node]];
+  }
+  queues_ = std::make_unique<ReadyQueue[]>(kQueueCount);
+  for (std::size_t queue = 0; queue < kQueueCount; ++queue) {
+    queues_[queue].Reserve(queue_sizes[queue]);
+  }
+  pending_ = std::make_unique<std::atomic<std::uint32_t>[]>(kNodeCount);
+
+  finalized_ = true;
+  return true;
+}
+
+bool TaskGraph::Execute(WorkerPool &pool) {
+  if (!finalized_ || pool.Size() != worker_count_) {
+    daal::log::FrameworkLogger::get()->Error("Task graph is not finalized or does not match pool size");
+    std::abort();
+  }
+  if (tasks_.empty()) {
+    return true;
+  }
+
+  for (std::size_t node = 0; node < tasks_.size(); ++node) {
+    pending_[node].store(predecessor_counts_[node], std::memory_order_relaxed);
+  }
+  for (std::size_t queue = 0; queue < worker_count_ + 2; ++queue) {
+    queues_[queue].Reset();
+  }
+  state_->completed.store(0, std::memory_order_relaxed);
+  state_->success.store(true, std::memory_order_relaxed);
+  for (const auto root : roots_) {
+    queues_[node_queues_[root]].Push(root);
+  }
+
+  if (worker_count_ != 0) {
+    pool.Fork(&TaskGraph::RunOnWorker, this);
+  }
+  RunExecutor(worker_count_);
+  if (worker_count_ != 0) {
+    pool.Join();
+  }
+  return state_->success.load(std::memory_order_relaxed);
+}
+
+bool TaskGraph::RunOnWorker(void *context, std::size_t worker) {
+  static_cast<TaskGraph *>(context)->RunExecutor(worker);
+  return true;
+}
+
+void TaskGraph::RunExecutor(std::size_t queue) {
+  const std::uint32_t kNodeCount{static_cast<std::uint32_t>(tasks_.size())};
+  auto &own_queue = queues_[queue];
+  auto &shared_queue = queues_[worker_count_ + 1];
+  while (state_->completed.load(std::memory_order_acquire) != kNodeCount) {
+    NodeId node{own_queue.TryPop()};
+    if (node == kNoNode) {
+      node = shared_queue.TryPop();
+    }
+    if (node == kNoNode) {
+      WaitForWork(queue);
+      continue;
+    }
+    daal::af::trace::Trace(daal::af::trace::TraceEvent::kNodeStart, node);
+    if (!tasks_[node]()) {
+      state_->success.store(false, std::memory_order_relaxed);
+    }
+    daal::af::trace::Trace(daal::af::trace::TraceEvent::kNodeEnd, node);
+    Complete(node);
+  }
+}
+
+void TaskGraph::Complete(NodeId node) {
+  bool released{false};
+  for (std::uint32_t idx = successor_offsets_[node]; idx < successor_offsets_[node + 1]; ++idx) {
+    const NodeId kSuccessor{successors_[idx]};
+    if (pending_[kSuccessor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      queues_[node_queues_[kSuccessor]].Push(kSuccessor);
+      released = true;
+    }
+  }
+  const std::uint32_t kCompleted{state_->completed.fetch_add(1, std::memory_order_acq_rel) + 1};
+  if (released || kCompleted == tasks_.size()) {
+    Publish();
+  }
+}
+
+void TaskGraph::Publish() noexcept {
+  state_->ready_epoch.fetch_add(1);
+  if (state_->sleepers.load() != 0) {
+    daal::af::sync::AtomicNotifyAll(state_->ready_epoch);
+  }
+}
+
+void TaskGraph::WaitForWork(std::size_t queue) {
+  const std::uint32_t kNodeCount{static_cast<std::uint32_t>(tasks_.size())};
+  const std::uint32_t kEpoch{state_->ready_epoch.load()};
+  for (std::uint32_t spin = 0; spin < kSpinCount; ++spin) {
+    if (state_->ready_epoch.load(std::memory_order_relaxed) != kEpoch || !queues_[queue].IsEmpty() ||
+        !queues_[worker_count_ + 1].IsEmpty() || state_->completed.load(std::memory_order_relaxed) == kNodeCount) {
+      return;
+    }
+  }
+  state_->sleepers.fetch_add(1);
+  if (queues_[queue].IsEmpty() && queues_[worker_count_ + 1].IsEmpty() &&
+      state_->completed.load() != kNodeCount) {
+    daal::af::sync::AtomicWait(state_->ready_epoch, kEpoch);
+  }
+  state_->sleepers.fetch_sub(1);
+}
+
+}  // namespace worker
+
+}  // namespace af
+
+}  // namespace daal
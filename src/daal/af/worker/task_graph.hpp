@@ -0,0 +1,220 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_WORKER_TASK_GRAPH_H_
+#define SRC_DAAL_AF_WORKER_TASK_GRAPH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "daal/af/worker/worker_pool.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace worker {
+
+/**
+ * \class TaskGraph
+ * \brief Directed acyclic graph of tasks executed on a WorkerPool and the
+ * calling thread.
+ *
+ * Nodes are added with the executor they are bound to: a worker of the pool,
+ * the thread calling Execute() (kMainThread) or any of them (kAnyWorker).
+ * Dependencies are explicit edges between nodes. A node becomes ready as soon
+ * as all its predecessors finished, independent branches therefore run
+ * concurrently and never wait for unrelated nodes.
+ *
+ * Finalize() validates the graph once (indices, executors, cycles) and stores
+ * it flat: successors in a single array indexed by per-node offsets, pending
+ * counters in a contiguous array. Executing the graph neither allocates nor
+ * takes a lock; ready nodes are handed out through per-executor queues with
+ * fixed capacity.
+ *
+ * \note
+ * - The graph must not be modified after Finalize().
+ * - A graph is executed on one pool at a time, the pool must not run anything
+ * else meanwhile.
+ */
+class TaskGraph {
+ public:
+  using Task = WorkerPool::Task;
+  using NodeId = std::uint32_t;
+
+  /**
+   * \brief Executor of nodes bound to the thread calling Execute().
+   */
+  static constexpr std::size_t kMainThread{WorkerPool::kAnyWorker - 1};
+
+  /**
+   * \brief Constructs an empty graph for a pool of the given size.
+   *
+   * \param worker_count Number of workers of the pool the graph is meant for.
+   */
+  explicit TaskGraph(std::size_t worker_count);
+
+  ~TaskGraph() = default;
+  TaskGraph(const TaskGraph &) = delete;
+  TaskGraph &operator=(const TaskGraph &) & = delete;
+  TaskGraph(TaskGraph &&) noexcept = default;
+  TaskGraph &operator=(TaskGraph &&) &noexcept = default;
+
+  /**
+   * \brief Adds a node to the graph.
+   *
+   * \param task The task of the node.
+   * \param executor Index of the worker, kMainThread or kAnyWorker. Nodes of
+   * kAnyWorker run on the calling thread if the pool has no workers.
+   * \return Id of the new node.
+   */
+  NodeId AddNode(Task task, std::size_t executor = WorkerPool::kAnyWorker);
+
+  /**
+   * \brief Adds a dependency, node after starts only after node before finished.
+   *
+   * \return false if one of the nodes does not exist or both are the same.
+   */
+  bool AddDependency(NodeId before, NodeId after);
+
+  /**
+   * \brief Validates the graph and builds the flat execution layout.
+   *
+   * \return false if the graph contains a cycle or a node is bound to a worker
+   * the pool does not have.
+   */
+  bool Finalize();
+
+  /**
+   * \brief Returns true if Finalize() succeeded.
+   */
+  bool IsFinalized() const noexcept;
+
+  /**
+   * \brief Returns the number of nodes.
+   */
+  std::size_t Size() const noexcept;
+
+  /**
+   * \brief Returns the nodes in a deterministic topological order. Ties are
+   * resolved by insertion order. Only valid after Finalize().
+   */
+  const std::vector<NodeId> &TopologicalOrder() const noexcept;
+
+  /**
+   * \brief Executes all nodes once and returns when all of them finished.
+   *
+   * \param pool The pool executing the worker nodes, its size must match the
+   * graph.
+   * \return true if all nodes succeeded, false otherwise.
+   */
+  bool Execute(WorkerPool &pool);
+
+ private:
+  static constexpr NodeId kNoNode{std::numeric_limits<NodeId>::max()};
+
+  /**
+   * \brief Fixed capacity multi-producer multi-consumer queue of ready nodes.
+   * Every node is pushed at most once per execution, so the queue never wraps.
+   */
+  class ReadyQueue {
+   public:
+    ReadyQueue() = default;
+    void Reserve(std::size_t capacity);
+    void Reset() noexcept;
+    void Push(NodeId node) noexcept;
+    NodeId TryPop() noexcept;
+    bool IsEmpty() const noexcept;
+
+   private:
+    std::unique_ptr<std::atomic<NodeId>[]> slots_;
+    std::size_t capacity_{0};
+    alignas(64) std::atomic<std::uint32_t> head_{0};
+    alignas(64) std::atomic<std::uint32_t> tail_{0};
+  };
+
+  /**
+   * \brief Entry point of the workers.
+   */
+  static bool RunOnWorker(void *context, std::size_t worker);
+
+  /**
+   * \brief Executes ready nodes of the given queue and the shared queue until
+   * the whole graph finished.
+   */
+  void RunExecutor(std::size_t queue);
+
+  /**
+   * \brief Releases the successors of a finished node.
+   */
+  void Complete(NodeId node);
+
+  /**
+   * \brief Blocks until new nodes became ready or the graph finished.
+   */
+  void WaitForWork(std::size_t queue);
+
+  /**
+   * \brief Returns the queue index of an executor.
+   */
+  std::size_t QueueOf(std::size_t executor) const noexcept;
+
+  /**
+   * \brief Wakes executors waiting for work.
+   */
+  void Publish() noexcept;
+
+  std::size_t worker_count_;
+  bool finalized_;
+
+  // Build-time description
+  std::vector<Task> tasks_;
+  std::vector<std::size_t> executors_;
+  std::vector<std::pair<NodeId, NodeId>> edges_;
+
+  // Flat execution layout, built by Finalize()
+  std::vector<std::uint32_t> successor_offsets_;  ///< successors of node n: [offsets[n], offsets[n + 1])
+  std::vector<NodeId> successors_;
+  std::vector<std::uint32_t> predecessor_counts_;
+  std::vector<std::uint32_t> node_queues_;  ///< queue index per node
+  std::vector<NodeId> topological_order_;
+  std::vector<NodeId> roots_;
+
+  /**
+   * \brief Counters shared by all executors during Execute().
+   */
+  struct ExecutionState {
+    alignas(64) std::atomic<std::uint32_t> completed{0};    ///< Number of finished nodes.
+    alignas(64) std::atomic<std::uint32_t> ready_epoch{0};  ///< Bumped whenever nodes became ready.
+    std::atomic<std::uint32_t> sleepers{0};                 ///< Executors waiting on ready_epoch.
+    std::atomic<bool> success{true};
+  };
+
+  // Execution state, kept behind pointers so the graph stays movable
+  std::unique_ptr<std::atomic<std::uint32_t>[]> pending_;  ///< unfinished predecessors per node
+  std::unique_ptr<ReadyQueue[]> queues_;  ///< one per worker, then the main thread, then the shared one
+  std::unique_ptr<ExecutionState> state_;
+};
+
+}  // namespace worker
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_WORKER_TASK_GRAPH_H_ */
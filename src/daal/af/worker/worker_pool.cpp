@@ -0,0 +1,177 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "worker_pool.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+#include "daal/af/trace/trace.hpp"
+#include "daal/log/framework_logger.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace worker {
+
+WorkerPool::Batch::Batch(std::size_t worker_count)
+    : worker_count_{worker_count},
+      pinned_(worker_count),
+      lanes_(worker_count),
+      lane_heads_{std::make_unique<std::atomic<std::size_t>[]>(worker_count)},
+      next_lane_{0},
+      stealable_count_{0} {
+  Reset();
+}
+
+void WorkerPool::Batch::Add(Task task, std::size_t worker) {
+  if (worker == kAnyWorker) {
+    if (worker_count_ == 0) {
+      daal::log::FrameworkLogger::get()->Error("Batch without workers cannot take stealable tasks");
+      std::abort();
+    }
+    lanes_[next_lane_].push_back(std::move(task));
+    next_lane_ = (next_lane_ + 1) % worker_count_;
+    ++stealable_count_;
+  } else if (worker < worker_count_) {
+    pinned_[worker].push_back(std::move(task));
+  } else {
+    daal::log::FrameworkLogger::get()->Error("Invalid worker index {} for pool of size {}", worker, worker_count_);
+    std::abort();
+  }
+}
+
+std::size_t WorkerPool::Batch::Size() const noexcept {
+  std::size_t size{stealable_count_};
+  for (const auto &tasks : pinned_) {
+    size += tasks.size();
+  }
+  return size;
+}
+
+void WorkerPool::Batch::Reset() noexcept {
+  for (std::size_t lane = 0; lane < worker_count_; ++lane) {
+    lane_heads_[lane].store(0, std::memory_order_relaxed);
+  }
+}
+
+bool WorkerPool::Batch::HasWorkFor(std::size_t worker) const noexcept {
+  return stealable_count_ != 0 || !pinned_[worker].empty();
+}
+
+bool WorkerPool::Batch::DrainLane(std::size_t lane) {
+  bool success = true;
+  const auto &tasks = lanes_[lane];
+  for (std::size_t idx = lane_heads_[lane].fetch_add(1, std::memory_order_relaxed); idx < tasks.size();
+       idx = lane_heads_[lane].fetch_add(1, std::memory_order_relaxed)) {
+    success = tasks[idx]() && success;
+  }
+  return success;
+}
+
+bool WorkerPool::Batch::Drain(std::size_t worker) {
+  bool success = true;
+  std::size_t first_lane{0};
+  if (worker != kAnyWorker) {
+    for (auto &task : pinned_[worker]) {
+      success = task() && success;
+    }
+    first_lane = worker;
+  }
+  // Own lane first, then steal from the others
+  for (std::size_t offset = 0; offset < worker_count_; ++offset) {
+    success = DrainLane((first_lane + offset) % worker_count_) && success;
+  }
+  return success;
+}
+
+WorkerPool::WorkerPool(const std::vector<unsigned int> &core_ids, int priority)
+    : contexts_(core_ids.size(), DrainContext{nullptr, nullptr, 0}), latch_{}, workers_{} {
+  workers_.reserve(core_ids.size());
+  for (const auto core_id : core_ids) {
+    workers_.push_back(std::make_unique<WorkerThread>(core_id, priority));
+  }
+  // the constructing thread is expected to fork and join, its trace buffer is not allocated on the cycle path
+  daal::af::trace::RegisterThread();
+}
+
+bool WorkerPool::DrainOnWorker(void *context) {
+  auto *drain_context = static_cast<DrainContext *>(context);
+  return drain_context->function(drain_context->context, drain_context->worker);
+}
+
+bool WorkerPool::DrainBatch(void *batch, std::size_t worker) { return static_cast<Batch *>(batch)->Drain(worker); }
+
+void WorkerPool::Post(std::size_t worker) {
+  daal::af::trace::Trace(daal::af::trace::TraceEvent::kSubmit, static_cast<std::uint32_t>(worker));
+  if (!workers_[worker]->Post(&WorkerPool::DrainOnWorker, &contexts_[worker], &latch_)) {
+    // Only one batch is in flight, so a worker of the pool is never busy here
+    daal::log::FrameworkLogger::get()->Error("Worker {} of pool is busy", worker);
+    std::abort();
+  }
+}
+
+std::size_t WorkerPool::Size() const noexcept { return workers_.size(); }
+
+WorkerPool::Batch WorkerPool::CreateBatch() const { return Batch(Size()); }
+
+void WorkerPool::Fork(Batch &batch) {
+  if (batch.worker_count_ != workers_.size()) {
+    daal::log::FrameworkLogger::get()->Error("Batch does not match pool size");
+    std::abort();
+  }
+  daal::af::trace::Trace(daal::af::trace::TraceEvent::kFork, static_cast<std::uint32_t>(batch.Size()));
+  batch.Reset();
+  std::uint32_t participants{0};
+  for (std::size_t worker = 0; worker < workers_.size(); ++worker) {
+    if (batch.HasWorkFor(worker)) {
+      ++participants;
+    }
+  }
+  latch_.Reset(participants);
+  for (std::size_t worker = 0; worker < workers_.size(); ++worker) {
+    if (batch.HasWorkFor(worker)) {
+      contexts_[worker] = DrainContext{&WorkerPool::DrainBatch, &batch, worker};
+      Post(worker);
+    }
+  }
+}
+
+bool WorkerPool::Join(Batch &batch) {
+  const bool kCallerSuccess{batch.Drain(kAnyWorker)};
+  return Join() && kCallerSuccess;
+}
+
+void WorkerPool::Fork(WorkerFunction function, void *context) {
+  daal::af::trace::Trace(daal::af::trace::TraceEvent::kFork);
+  latch_.Reset(static_cast<std::uint32_t>(workers_.size()));
+  for (std::size_t worker = 0; worker < workers_.size(); ++worker) {
+    contexts_[worker] = DrainContext{function, context, worker};
+    Post(worker);
+  }
+}
+
+bool WorkerPool::Join() {
+  daal::af::trace::Trace(daal::af::trace::TraceEvent::kJoinStart);
+  const bool kSuccess{latch_.Wait()};
+  daal::af::trace::Trace(daal::af::trace::TraceEvent::kJoinEnd);
+  return kSuccess;
+}
+
+}  // namespace worker
+
+}  // namespace af
+
+}  // namespace daal
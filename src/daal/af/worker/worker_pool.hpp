@@ -0,0 +1,243 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_AF_WORKER_WORKER_POOL_H_
+#define SRC_DAAL_AF_WORKER_WORKER_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "daal/af/sync/completion_latch.hpp"
+#include "daal/af/worker/worker_thread.hpp"
+
+namespace daal {
+
+namespace af {
+
+namespace worker {
+
+/**
+ * \class WorkerPool
+ * \brief Manages a set of pinned worker threads that execute batches of tasks
+ * with work stealing.
+ *
+ * Every worker is a WorkerThread pinned to its own core. Tasks are grouped in a
+ * Batch. A task is either pinned to a worker (static affinity) or may run on
+ * any worker. Tasks that may run on any worker are distributed round robin over
+ * per-worker lanes; a worker that finished its own lane steals the remaining
+ * tasks from the lanes of the other workers. The thread calling Join() takes
+ * part in stealing as well before it waits for the workers.
+ *
+ * Forking a batch posts a preallocated context to each worker and joining
+ * waits on a completion latch, so neither allocates nor takes a lock.
+ *
+ * \note
+ * - A batch must not be modified between Fork() and Join().
+ * - Only one batch can be in flight per pool at a time.
+ */
+class WorkerPool {
+ public:
+  /**
+   * \brief Task executed by the pool. Returns true on success.
+   */
+  using Task = std::function<bool()>;
+
+  /**
+   * \brief Worker index of tasks that may run on any worker.
+   */
+  static constexpr std::size_t kAnyWorker{std::numeric_limits<std::size_t>::max()};
+
+  /**
+   * \brief Function executed on every worker by Fork(WorkerFunction, void *).
+   * Receives the context and the index of the executing worker.
+   */
+  using WorkerFunction = bool (*)(void *context, std::size_t worker);
+
+  /**
+   * \class Batch
+   * \brief Set of tasks forked to and joined from the pool in one go.
+   *
+   * A batch is built once and can be executed any number of times. Claiming a
+   * task is a single atomic increment on the lane it belongs to, so executing
+   * a batch does not allocate.
+   */
+  class Batch {
+   public:
+    /**
+     * \brief Constructs an empty batch for a pool of the given size.
+     *
+     * \param worker_count Number of workers of the pool the batch is meant for.
+     */
+    explicit Batch(std::size_t worker_count);
+
+    ~Batch() = default;
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) & = delete;
+    Batch(Batch &&) noexcept = default;
+    Batch &operator=(Batch &&) &noexcept = default;
+
+    /**
+     * \brief Adds a task to the batch.
+     *
+     * \param task The task to be executed.
+     * \param worker Index of the worker the task is pinned to or kAnyWorker if
+     * the task may be executed (and stolen) by any worker.
+     */
+    void Add(Task task, std::size_t worker = kAnyWorker);
+
+    /**
+     * \brief Returns the number of tasks in the batch.
+     */
+    std::size_t Size() const noexcept;
+
+   private:
+    friend class WorkerPool;
+
+    /**
+     * \brief Rewinds all lanes so the batch can be executed again.
+     */
+    void Reset() noexcept;
+
+    /**
+     * \brief Executes the pinned tasks and the own lane of the given worker and
+     * steals from the other lanes afterwards.
+     *
+     * \param worker Index of the executing worker or kAnyWorker for the thread
+     * calling Join().
+     * \return true if all tasks executed by the calling thread succeeded.
+     */
+    bool Drain(std::size_t worker);
+
+    /**
+     * \brief Executes unclaimed tasks of a lane until it is exhausted.
+     */
+    bool DrainLane(std::size_t lane);
+
+    /**
+     * \brief Returns true if the given worker has anything to do.
+     */
+    bool HasWorkFor(std::size_t worker) const noexcept;
+
+    std::size_t worker_count_;
+    std::vector<std::vector<Task>> pinned_;  ///< Tasks pinned to a worker, per worker.
+    std::vector<std::vector<Task>> lanes_;   ///< Stealable tasks, per worker.
+    std::unique_ptr<std::atomic<std::size_t>[]> lane_heads_;  ///< Next unclaimed task, per lane.
+    std::size_t next_lane_;                                   ///< Lane receiving the next stealable task.
+    std::size_t stealable_count_;                             ///< Number of stealable tasks.
+  };
+
+  WorkerPool() = delete;
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) & = delete;
+  WorkerPool(WorkerPool &&) = delete;
+  WorkerPool &operator=(WorkerPool &&) & = delete;
+
+  /**
+   * \brief Constructs a pool with one worker per given core.
+   *
+   * The calling thread is registered for tracing, like the workers.
+   *
+   * \param core_ids The cores the workers are affined to, one worker per entry.
+   * \param priority The priority of the worker threads.
+   */
+  WorkerPool(const std::vector<unsigned int> &core_ids, int priority);
+
+  /**
+   * \brief Destructor. Stops and joins all workers.
+   */
+  ~WorkerPool() = default;
+
+  /**
+   * \brief Returns the number of workers.
+   */
+  std::size_t Size() const noexcept;
+
+  /**
+   * \brief Creates an empty batch matching the size of this pool.
+   */
+  Batch CreateBatch() const;
+
+  /**
+   * \brief Hands the batch to the workers and returns immediately.
+   *
+   * \param batch The batch to be executed. Must stay alive until Join().
+   */
+  void Fork(Batch &batch);
+
+  /**
+   * \brief Helps executing the stealable tasks of the batch and waits until all
+   * workers are done.
+   *
+   * \param batch The batch passed to Fork().
+   * \return true if all tasks of the batch succeeded, false otherwise.
+   */
+  bool Join(Batch &batch);
+
+  /**
+   * \brief Runs the given function once on every worker and returns
+   * immediately.
+   *
+   * \param function The function to be executed.
+   * \param context Context passed to the function. Must stay alive until Join().
+   */
+  void Fork(WorkerFunction function, void *context);
+
+  /**
+   * \brief Waits until all workers returned from the function passed to
+   * Fork(WorkerFunction, void *).
+   *
+   * \return true if the function returned true on all workers.
+   */
+  bool Join();
+
+ private:
+  /**
+   * \brief Context handed to a worker.
+   */
+  struct DrainContext {
+    WorkerFunction function;
+    void *context;
+    std::size_t worker;
+  };
+
+  /**
+   * \brief Entry point executed on the worker, runs the function of the context.
+   */
+  static bool DrainOnWorker(void *context);
+
+  /**
+   * \brief Adapter draining a batch on a worker.
+   */
+  static bool DrainBatch(void *batch, std::size_t worker);
+
+  /**
+   * \brief Posts the prepared context of the given worker.
+   */
+  void Post(std::size_t worker);
+
+  std::vector<DrainContext> contexts_;  ///< Preallocated, one per worker.
+  daal::af::sync::CompletionLatch latch_;
+  std::vector<std::unique_ptr<WorkerThread>> workers_;  ///< Last member, joins the threads before the others go.
+};
+
+}  // namespace worker
+
+}  // namespace af
+
+}  // namespace daal
+
+#endif /* SRC_DAAL_AF_WORKER_WORKER_POOL_H_ */
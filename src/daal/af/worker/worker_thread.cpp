@@ -17,11 +17,13 @@
 
 #include <atomic>
 #include <cerrno>
-#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
 #include <future>
+#include <memory>
 
+#include "daal/af/sync/atomic_wait.hpp"
+#include "daal/af/trace/trace.hpp"
 #include "daal/log/framework_logger.hpp"
 
 namespace daal {
@@ -30,14 +32,18 @@ namespace af {
 
 namespace worker {
 
+namespace {
+/** Number of polls before a waiting side goes to sleep. */
+constexpr std::uint32_t kSpinCount{2000};
+}  // namespace
+
 WorkerThread::WorkerThread(unsigned int core_id, int priority)
     : worker_thread_(),
-      tasks_{},
-      mutex_{},
-      condition_{},
-      submit_condition_{},
-      worker_promise_{nullptr},
-      stop_flag_{false},
+      ring_{},
+      head_{0},
+      tail_{0},
+      worker_sleeping_{false},
+      producer_sleeping_{false},
       thread_attr_{},
       core_id_{core_id} {
   // Initialize thread attributes
@@ -68,19 +74,11 @@ WorkerThread::WorkerThread(unsigned int core_id, int priority)
     daal::log::FrameworkLogger::get()->Error("Error in creating thread");
     std::abort();
   }
-
-  // wait for the thread to be ready
-  std::unique_lock<std::mutex> lock(mutex_);
-  submit_condition_.wait(lock, [this] { return tasks_.empty(); });
 }
 
 WorkerThread::~WorkerThread() {
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    stop_flag_.store(true);
-    condition_.notify_all();
-    FulFillPromise(false);
-  }
+  // The stop request is queued behind all pending tasks
+  PostBlocking(TaskSlot{nullptr, nullptr, nullptr});
   int ret_join = pthread_join(worker_thread_, nullptr);
   if (ret_join != 0) {
     daal::log::FrameworkLogger::get()->Error("Joining thread: {}", strerror(ret_join));
@@ -98,77 +96,128 @@ void *WorkerThread::ThreadEntryFunction(void *arg) {
     daal::log::FrameworkLogger::get()->Error("Failed to set thread affinity for core: {}", self->core_id_);
     std::abort();
   }
+  daal::af::trace::RegisterThread();
   self->Run();
   return nullptr;
 }
 
+bool WorkerThread::TryPush(TaskSlot slot) noexcept {
+  const std::uint32_t kTail{tail_.load(std::memory_order_relaxed)};
+  if (kTail - head_.load(std::memory_order_acquire) == kRingCapacity) {
+    return false;
+  }
+  ring_[kTail % kRingCapacity] = slot;
+  tail_.store(kTail + 1);
+  if (worker_sleeping_.load()) {
+    daal::af::sync::AtomicNotifyOne(tail_);
+  }
+  return true;
+}
+
+void WorkerThread::PostBlocking(TaskSlot slot) noexcept {
+  std::uint32_t spin{0};
+  while (!TryPush(slot)) {
+    if (spin < kSpinCount) {
+      ++spin;
+      continue;
+    }
+    producer_sleeping_.store(true);
+    const std::uint32_t kHead{head_.load()};
+    if (tail_.load(std::memory_order_relaxed) - kHead == kRingCapacity) {
+      daal::af::sync::AtomicWait(head_, kHead);
+    }
+    producer_sleeping_.store(false);
+  }
+}
+
+bool WorkerThread::Post(TaskFunction function, void *context, daal::af::sync::CompletionLatch *latch) noexcept {
+  if (nullptr == function) {
+    return false;
+  }
+  return TryPush(TaskSlot{function, context, latch});
+}
+
+bool WorkerThread::IsIdle() const noexcept {
+  return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+}
+
+bool WorkerThread::RunPromisedTasks(void *context) {
+  std::unique_ptr<PromisedTasks> promised_tasks{static_cast<PromisedTasks *>(context)};
+  bool apps_success_ = true;
+  while (!promised_tasks->tasks.empty()) {
+    auto &application_execution = promised_tasks->tasks.front();
+    apps_success_ = application_execution() && apps_success_;
+    promised_tasks->tasks.pop();
+  }
+  promised_tasks->promise.set_value(apps_success_);
+  return apps_success_;
+}
+
 std::future<bool> WorkerThread::Submit(std::function<bool()> task) {
   TaskList tasks;
-  tasks.push(task);
-  return Submit(tasks);
+  tasks.push(std::move(task));
+  return Submit(std::move(tasks));
 }
 
 std::future<bool> WorkerThread::Submit(TaskList new_tasks) {
   if (new_tasks.empty()) {
-    auto worker_promise = std::make_unique<std::promise<bool>>();
-    std::future<bool> worker_future = worker_promise->get_future();
-    worker_promise->set_value(false);
+    std::promise<bool> worker_promise;
+    std::future<bool> worker_future = worker_promise.get_future();
+    worker_promise.set_value(false);
     return worker_future;
   }
-  std::unique_lock<std::mutex> lock(mutex_);
-  submit_condition_.wait(lock, [this] { return tasks_.empty(); });
-  auto worker_promise = std::make_unique<std::promise<bool>>();
-  std::future<bool> worker_future = worker_promise->get_future();
-  while (!new_tasks.empty()) {
-    tasks_.push(std::move(new_tasks.front()));
-    new_tasks.pop();
-  }
-  worker_promise_ = std::move(worker_promise);
-  condition_.notify_all();
+  auto promised_tasks = std::make_unique<PromisedTasks>();
+  promised_tasks->tasks = std::move(new_tasks);
+  std::future<bool> worker_future = promised_tasks->promise.get_future();
+  PostBlocking(TaskSlot{&WorkerThread::RunPromisedTasks, promised_tasks.release(), nullptr});
   return worker_future;
 }
 
 std::future<bool> WorkerThread::TrySubmit(TaskList new_tasks) {
-  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
-  if (!lock.owns_lock() || tasks_.size() != 0) {
-    auto worker_promise = std::make_unique<std::promise<bool>>();
-    std::future<bool> worker_future = worker_promise->get_future();
-    worker_promise->set_value(false);
-    worker_promise = nullptr;
+  if (!IsIdle()) {
+    std::promise<bool> worker_promise;
+    std::future<bool> worker_future = worker_promise.get_future();
+    worker_promise.set_value(false);
     return worker_future;
-  } else {
-    lock.unlock();
-    return Submit(std::move(new_tasks));
-  }
-}
-
-void WorkerThread::FulFillPromise(bool value) {
-  if (nullptr != worker_promise_) {
-    worker_promise_->set_value(value);
-    worker_promise_ = nullptr;
   }
+  return Submit(std::move(new_tasks));
 }
 
 void WorkerThread::Run() {
-  while (!stop_flag_.load()) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    condition_.wait(lock, [this] { return !tasks_.empty() || stop_flag_.load(); });
+  while (true) {
+    const std::uint32_t kHead{head_.load(std::memory_order_relaxed)};
+
+    // Wait for work, spin shortly before going to sleep
+    std::uint32_t spin{0};
+    while (tail_.load(std::memory_order_acquire) == kHead) {
+      if (spin < kSpinCount) {
+        ++spin;
+        continue;
+      }
+      worker_sleeping_.store(true);
+      if (tail_.load() == kHead) {
+        daal::af::sync::AtomicWait(tail_, kHead);
+      }
+      worker_sleeping_.store(false);
+    }
 
-    if (stop_flag_.load()) {
-      FulFillPromise(false);
-      lock.unlock();
+    const TaskSlot kSlot{ring_[kHead % kRingCapacity]};
+    if (nullptr == kSlot.function) {
+      head_.store(kHead + 1);
       return;
     }
 
-    bool apps_success_ = true;
-    while (!tasks_.empty()) {
-      auto application_execution = tasks_.front();
-      apps_success_ = application_execution() && apps_success_;
-      tasks_.pop();
+    const bool kSuccess{kSlot.function(kSlot.context)};
+
+    // Release the slot before reporting, so the worker is idle once the
+    // result is visible
+    head_.store(kHead + 1);
+    if (producer_sleeping_.load()) {
+      daal::af::sync::AtomicNotifyOne(head_);
+    }
+    if (nullptr != kSlot.latch) {
+      kSlot.latch->CountDown(kSuccess);
     }
-    FulFillPromise(apps_success_);
-    lock.unlock();
-    submit_condition_.notify_all();
   }
 }
 
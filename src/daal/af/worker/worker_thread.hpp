@@ -16,14 +16,16 @@
 #include <pthread.h>
 #include <sched.h>
 
+#include <array>
 #include <atomic>
-#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <future>
-#include <memory>
-#include <mutex>
 #include <queue>
 
+#include "daal/af/sync/completion_latch.hpp"
+
 namespace daal {
 
 namespace af {
@@ -37,11 +39,19 @@ namespace worker {
  * execute a list of tasks with specified core affinity and priority. It
  * ensures proper resource management and thread synchronization.
  *
+ * Tasks are handed over through a preallocated single-producer/single-consumer
+ * ring of fixed size task slots. A slot holds a plain function pointer, its
+ * context and an optional CompletionLatch that receives the result. Post()
+ * neither allocates nor locks, so it is the submission path for cyclic code.
+ * The std::future based Submit()/TrySubmit() functions are kept for
+ * convenience; they allocate the task list and the promise per call.
+ *
  * \note
  * - The worker thread runs in a loop, waiting for tasks to be submitted and
- *   executing them.
- * - Proper synchronization is ensured using mutex and condition variable.
- * - The stop_flag_ is used to signal the thread to stop execution.
+ *   executing them. It sleeps on the ring position (futex) when idle.
+ * - All submitting functions must be called from one thread only.
+ * - On destruction all tasks already handed over are executed before the
+ *   thread stops.
  */
 class WorkerThread {
  public:
@@ -84,9 +94,40 @@ class WorkerThread {
   using TaskList = std::queue<std::function<bool()>>;
 
   /**
-   * \brief Submits a list of tasks to the worker thread. If the thread is not
-   * free to accept new tasks then Sumbit function will block until worker
-   * thread is free.
+   * \brief Allocation free task: a function pointer with its context.
+   *
+   * The function returns a boolean indicating success or failure.
+   */
+  using TaskFunction = bool (*)(void *context);
+
+  /**
+   * \brief Number of task slots of the submission ring.
+   */
+  static constexpr std::uint32_t kRingCapacity{16};
+
+  /**
+   * \brief Hands a task over to the worker thread without allocating or
+   * locking.
+   *
+   * \param function The function to be executed by the worker.
+   * \param context The argument passed to the function.
+   * \param latch Latch that receives the result of the task, may be nullptr.
+   * The latch must be armed by the caller.
+   * \return true if the task was queued, false if the ring is full.
+   */
+  bool Post(TaskFunction function, void *context, daal::af::sync::CompletionLatch *latch) noexcept;
+
+  /**
+   * \brief Checks whether all handed over tasks are finished.
+   *
+   * \return true if the worker has nothing to do.
+   */
+  bool IsIdle() const noexcept;
+
+  /**
+   * \brief Submits a list of tasks to the worker thread. The tasks are queued
+   * behind the tasks already handed over. If the submission ring is full then
+   * Submit function will block until a slot is free.
    *
    * \param new_tasks The list of tasks to be executed.
    * \return A future that will be set with the result of task execution.
@@ -94,9 +135,9 @@ class WorkerThread {
   std::future<bool> Submit(TaskList new_tasks);
 
   /**
-   * \brief Submits a list of tasks to the worker thread. If the thread is not
-   * free to accept new tasks then Sumbit function will block until worker
-   * thread is free.
+   * \brief Submits a list of tasks to the worker thread. The tasks are queued
+   * behind the tasks already handed over. If the submission ring is full then
+   * Submit function will block until a slot is free.
    *
    * \param task Single tasks to be executed.
    * \return A future that will be set with the result of task execution.
@@ -113,6 +154,23 @@ class WorkerThread {
   std::future<bool> TrySubmit(TaskList new_tasks);
 
  private:
+  /**
+   * \brief Task slot of the submission ring.
+   */
+  struct TaskSlot {
+    TaskFunction function;                   ///< Function to execute, nullptr requests a stop.
+    void *context;                           ///< Argument of the function.
+    daal::af::sync::CompletionLatch *latch;  ///< Receives the result, may be nullptr.
+  };
+
+  /**
+   * \brief Heap allocated state of a std::future based submission.
+   */
+  struct PromisedTasks {
+    TaskList tasks;
+    std::promise<bool> promise;
+  };
+
   /**
    * \brief Starts the worker thread.
    *
@@ -132,23 +190,33 @@ class WorkerThread {
    * \return true if the affinity was successfully set, false otherwise.
    */
   bool SetThreadAffinity(unsigned int core_id);
-  /**   * \brief Fulfills the promise with the specified value.
+  /**
+   * \brief Executes a task list of a std::future based submission and fulfills
+   * its promise.
    *
-   * \param success The value to fulfill the promise with.
+   * \param context Pointer to the PromisedTasks, owned by this function.
+   * \return The result of the task list.
+   */
+  static bool RunPromisedTasks(void *context);
+  /**
+   * \brief Queues a slot, waits for a free slot if the ring is full.
+   */
+  void PostBlocking(TaskSlot slot) noexcept;
+  /**
+   * \brief Queues a slot if the ring has space.
    */
-  void FulFillPromise(bool);
+  bool TryPush(TaskSlot slot) noexcept;
   /**   * \brief Main loop for the worker thread.
    *    * This function runs in a loop, waiting for tasks to be submitted and
    * executing them.   */
   void Run();
 
   pthread_t worker_thread_;
-  TaskList tasks_;
-  std::mutex mutex_;
-  std::condition_variable condition_;
-  std::condition_variable submit_condition_;
-  std::unique_ptr<std::promise<bool>> worker_promise_;
-  std::atomic<bool> stop_flag_;
+  std::array<TaskSlot, kRingCapacity> ring_;
+  alignas(64) std::atomic<std::uint32_t> head_;  ///< Next slot to execute, written by the worker.
+  alignas(64) std::atomic<std::uint32_t> tail_;  ///< Next free slot, written by the producer.
+  std::atomic<bool> worker_sleeping_;            ///< Worker waits for tail_ to change.
+  std::atomic<bool> producer_sleeping_;          ///< Producer waits for head_ to change.
   pthread_attr_t thread_attr_;
   unsigned int core_id_;
 };
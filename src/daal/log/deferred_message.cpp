@@ -0,0 +1,147 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "deferred_message.hpp"
+
+#include <fmt/args.h>
+
+#include <algorithm>
+
+namespace daal {
+namespace log {
+
+namespace {
+
+/** Reads encoded arguments with bounds checks, the data may come from a file. */
+class DeferredReader {
+ public:
+  DeferredReader(const std::uint8_t *data, std::size_t size) noexcept : data_{data}, size_{size} {}
+
+  bool IsAtEnd() const noexcept { return offset_ == size_; }
+
+  template <typename T>
+  bool Read(T &value) noexcept {
+    if (sizeof(T) > size_ - offset_) {
+      return false;
+    }
+    std::memcpy(&value, &data_[offset_], sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(fmt::string_view &value) noexcept {
+    std::uint16_t length{0};
+    if (!Read(length) || length > size_ - offset_) {
+      return false;
+    }
+    value = fmt::string_view{reinterpret_cast<const char *>(&data_[offset_]), length};
+    offset_ += length;
+    return true;
+  }
+
+ private:
+  const std::uint8_t *data_;
+  std::size_t size_;
+  std::size_t offset_{0};
+};
+
+template <typename T>
+bool PushArg(DeferredReader &reader, fmt::dynamic_format_arg_store<fmt::format_context> &store) {
+  T value{};
+  if (!reader.Read(value)) {
+    return false;
+  }
+  store.push_back(value);
+  return true;
+}
+
+bool PushArgs(DeferredReader &reader, fmt::dynamic_format_arg_store<fmt::format_context> &store) {
+  while (!reader.IsAtEnd()) {
+    std::uint8_t type{0};
+    bool is_valid{reader.Read(type)};
+    switch (static_cast<DeferredArgType>(type)) {
+      case DeferredArgType::kBool:
+        is_valid = is_valid && PushArg<bool>(reader, store);
+        break;
+      case DeferredArgType::kChar:
+        is_valid = is_valid && PushArg<char>(reader, store);
+        break;
+      case DeferredArgType::kInt:
+        is_valid = is_valid && PushArg<std::int64_t>(reader, store);
+        break;
+      case DeferredArgType::kUInt:
+        is_valid = is_valid && PushArg<std::uint64_t>(reader, store);
+        break;
+      case DeferredArgType::kFloat:
+        is_valid = is_valid && PushArg<float>(reader, store);
+        break;
+      case DeferredArgType::kDouble:
+        is_valid = is_valid && PushArg<double>(reader, store);
+        break;
+      case DeferredArgType::kString: {
+        fmt::string_view value{};
+        is_valid = is_valid && reader.ReadString(value);
+        if (is_valid) {
+          store.push_back(value);
+        }
+        break;
+      }
+      case DeferredArgType::kPointer: {
+        std::uintptr_t value{0};
+        is_valid = is_valid && reader.Read(value);
+        if (is_valid) {
+          store.push_back(reinterpret_cast<const void *>(value));
+        }
+        break;
+      }
+      default:
+        is_valid = false;
+        break;
+    }
+    if (!is_valid) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void Terminate(char *out, std::size_t capacity, std::size_t length) noexcept {
+  out[std::min(length, capacity - 1)] = '\0';
+}
+
+}  // namespace
+
+bool FormatDeferred(fmt::string_view format, const std::uint8_t *args, std::size_t size, char *out,
+                    std::size_t capacity) {
+  if (capacity == 0) {
+    return false;
+  }
+  fmt::dynamic_format_arg_store<fmt::format_context> store;
+  DeferredReader reader{args, size};
+  if (format.size() == 0 || !PushArgs(reader, store)) {
+    const auto kResult = fmt::format_to_n(out, capacity - 1, "<malformed deferred message>");
+    Terminate(out, capacity, kResult.size);
+    return false;
+  }
+  const auto kResult = fmt::vformat_to_n(out, capacity - 1, format, store);
+  Terminate(out, capacity, kResult.size);
+  return true;
+}
+
+bool FormatDeferred(const DeferredMessage &message, MessageBuffer &buffer) {
+  return FormatDeferred(FormatRegistry::Get().Lookup(message.format_id), message.args.data(), message.size,
+                        buffer.data(), buffer.size());
+}
+
+}  // namespace log
+}  // namespace daal
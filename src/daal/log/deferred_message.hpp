@@ -0,0 +1,240 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_LOG_DEFERRED_MESSAGE_H_
+#define SRC_DAAL_LOG_DEFERRED_MESSAGE_H_
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "daal/log/format_registry.hpp"
+#include "daal/log/logger_types.hpp"
+
+namespace daal {
+namespace log {
+
+/** Type tags of the encoded arguments of a deferred message. */
+enum class DeferredArgType : std::uint8_t {
+  kBool = 0,
+  kChar,
+  kInt,     ///< Any signed integer, stored as 64 bit.
+  kUInt,    ///< Any unsigned integer, stored as 64 bit.
+  kFloat,
+  kDouble,
+  kString,  ///< 16 bit length followed by the characters.
+  kPointer,
+};
+
+/**
+ * @brief A log message whose formatting is deferred: the id of its format string and the raw argument bytes.
+ *
+ * Every argument is stored as a DeferredArgType tag followed by its value. Strings are copied, so the message does not
+ * refer to any data of the caller.
+ */
+struct DeferredMessage {
+  /** Id of the format string in the FormatRegistry. */
+  std::uint16_t format_id{FormatRegistry::kInvalidId};
+
+  /** Number of used bytes of args. */
+  std::uint16_t size{0};
+
+  /** Encoded arguments. */
+  std::array<std::uint8_t, config::kMaxDeferredArgBytes> args;
+};
+
+namespace details {
+
+/** Appends encoded arguments to a DeferredMessage. */
+class DeferredWriter {
+ public:
+  explicit DeferredWriter(DeferredMessage &message) noexcept : message_{message} { message_.size = 0; }
+
+  void Put(DeferredArgType type, const void *value, std::size_t size) noexcept {
+    if (Reserve(1 + size)) {
+      message_.args[message_.size++] = static_cast<std::uint8_t>(type);
+      std::memcpy(&message_.args[message_.size], value, size);
+      message_.size = static_cast<std::uint16_t>(message_.size + size);
+    }
+  }
+
+  void PutString(const char *data, std::size_t size) noexcept {
+    const auto kLength = static_cast<std::uint16_t>(size);
+    if (size <= UINT16_MAX && Reserve(1 + sizeof(kLength) + size)) {
+      message_.args[message_.size++] = static_cast<std::uint8_t>(DeferredArgType::kString);
+      std::memcpy(&message_.args[message_.size], &kLength, sizeof(kLength));
+      std::memcpy(&message_.args[message_.size + sizeof(kLength)], data, size);
+      message_.size = static_cast<std::uint16_t>(message_.size + sizeof(kLength) + size);
+    }
+  }
+
+  bool IsValid() const noexcept { return is_valid_; }
+
+ private:
+  bool Reserve(std::size_t size) noexcept {
+    is_valid_ = is_valid_ && (size <= message_.args.size() - message_.size);
+    return is_valid_;
+  }
+
+  DeferredMessage &message_;
+  bool is_valid_{true};
+};
+
+/** Encoding of an argument type, types without specialization are formatted immediately. */
+template <typename T, typename Enable = void>
+struct DeferredArg {
+  static constexpr bool kIsSupported{false};
+};
+
+template <>
+struct DeferredArg<bool> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, bool value) noexcept {
+    writer.Put(DeferredArgType::kBool, &value, sizeof(value));
+  }
+};
+
+template <>
+struct DeferredArg<char> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, char value) noexcept {
+    writer.Put(DeferredArgType::kChar, &value, sizeof(value));
+  }
+};
+
+template <typename T>
+struct DeferredArg<T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value &&
+                                       !std::is_same<T, char>::value>> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, T value) noexcept {
+    const auto kValue = static_cast<std::int64_t>(value);
+    writer.Put(DeferredArgType::kInt, &kValue, sizeof(kValue));
+  }
+};
+
+template <typename T>
+struct DeferredArg<T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value &&
+                                       !std::is_same<T, char>::value && !std::is_same<T, bool>::value>> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, T value) noexcept {
+    const auto kValue = static_cast<std::uint64_t>(value);
+    writer.Put(DeferredArgType::kUInt, &kValue, sizeof(kValue));
+  }
+};
+
+template <>
+struct DeferredArg<float> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, float value) noexcept {
+    writer.Put(DeferredArgType::kFloat, &value, sizeof(value));
+  }
+};
+
+template <>
+struct DeferredArg<double> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, double value) noexcept {
+    writer.Put(DeferredArgType::kDouble, &value, sizeof(value));
+  }
+};
+
+template <>
+struct DeferredArg<const char *> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, const char *value) noexcept {
+    if (nullptr == value) {
+      value = "(null)";
+    }
+    writer.PutString(value, std::strlen(value));
+  }
+};
+
+template <>
+struct DeferredArg<char *> : DeferredArg<const char *> {};
+
+template <>
+struct DeferredArg<std::string_view> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, std::string_view value) noexcept {
+    writer.PutString(value.data(), value.size());
+  }
+};
+
+template <>
+struct DeferredArg<std::string> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, const std::string &value) noexcept {
+    writer.PutString(value.data(), value.size());
+  }
+};
+
+template <>
+struct DeferredArg<fmt::string_view> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, fmt::string_view value) noexcept {
+    writer.PutString(value.data(), value.size());
+  }
+};
+
+template <>
+struct DeferredArg<const void *> {
+  static constexpr bool kIsSupported{true};
+  static void Write(DeferredWriter &writer, const void *value) noexcept {
+    const auto kValue = reinterpret_cast<std::uintptr_t>(value);
+    writer.Put(DeferredArgType::kPointer, &kValue, sizeof(kValue));
+  }
+};
+
+template <>
+struct DeferredArg<void *> : DeferredArg<const void *> {};
+
+}  // namespace details
+
+/** True if all argument types can be stored in a DeferredMessage. */
+template <typename... T>
+constexpr bool kIsDeferrable{(details::DeferredArg<std::decay_t<T>>::kIsSupported && ...)};
+
+/**
+ * @brief Store a message without formatting it.
+ * @return false if the arguments do not fit into the message or the format registry is full.
+ */
+template <typename... T>
+bool EncodeDeferred(DeferredMessage &message, fmt::string_view format, const T &...args) noexcept {
+  static_assert(kIsDeferrable<T...>, "Argument type cannot be deferred");
+  message.format_id = FormatRegistry::Get().Intern(format);
+  details::DeferredWriter writer{message};
+  (details::DeferredArg<std::decay_t<T>>::Write(writer, args), ...);
+  return writer.IsValid() && message.format_id != FormatRegistry::kInvalidId;
+}
+
+/**
+ * @brief Format encoded arguments with the given format string into a nul terminated buffer.
+ * @return false if the arguments are malformed, the buffer then holds a placeholder text.
+ */
+bool FormatDeferred(fmt::string_view format, const std::uint8_t *args, std::size_t size, char *out,
+                    std::size_t capacity);
+
+/**
+ * @brief Format a deferred message using the format registry of this process.
+ */
+bool FormatDeferred(const DeferredMessage &message, MessageBuffer &buffer);
+
+}  // namespace log
+}  // namespace daal
+
+#endif  // SRC_DAAL_LOG_DEFERRED_MESSAGE_H_
@@ -0,0 +1,211 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "async_sink.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "daal/af/sync/atomic_wait.hpp"
+
+namespace daal {
+namespace log {
+
+namespace {
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+  std::size_t result{1};
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+
+}  // namespace
+
+AsyncSink::AsyncSink(std::shared_ptr<Sink> sink, std::size_t capacity)
+    : sink_{std::move(sink)},
+      slots_{std::make_unique<Slot[]>(RoundUpToPowerOfTwo(capacity))},
+      mask_{RoundUpToPowerOfTwo(capacity) - 1} {
+  for (std::size_t idx = 0; idx <= mask_; ++idx) {
+    slots_[idx].sequence.store(idx, std::memory_order_relaxed);
+  }
+  thread_ = std::thread(&AsyncSink::Drain, this);
+}
+
+AsyncSink::~AsyncSink() {
+  is_stopped_.store(true);
+  WakeDrain();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  if (sink_) {
+    sink_->Flush();
+  }
+}
+
+void AsyncSink::ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) {
+  if (!WouldShow(log_level) || !sink_) {
+    return;
+  }
+  std::uint64_t position{0};
+  Slot *const kSlot{Claim(position)};
+  if (nullptr != kSlot) {
+    kSlot->log_level = log_level;
+    kSlot->is_deferred = false;
+    kSlot->message = buffer;
+    Publish(*kSlot, position);
+  }
+}
+
+void AsyncSink::ShowDeferred(LogLevel log_level, const DeferredMessage &message) {
+  if (!WouldShow(log_level) || !sink_) {
+    return;
+  }
+  std::uint64_t position{0};
+  Slot *const kSlot{Claim(position)};
+  if (nullptr != kSlot) {
+    kSlot->log_level = log_level;
+    kSlot->is_deferred = true;
+    kSlot->deferred.format_id = message.format_id;
+    kSlot->deferred.size = message.size;
+    // Copy the used bytes only
+    std::copy_n(message.args.begin(), message.size, kSlot->deferred.args.begin());
+    Publish(*kSlot, position);
+  }
+}
+
+bool AsyncSink::IsDeferred() const { return true; }
+
+AsyncSink::Slot *AsyncSink::Claim(std::uint64_t &position) noexcept {
+  position = tail_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot *const kSlot{&slots_[position & mask_]};
+    const std::uint64_t kSequence{kSlot->sequence.load(std::memory_order_acquire)};
+    if (kSequence == position) {
+      if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        return kSlot;
+      }
+    } else if (kSequence < position) {
+      // The drain thread did not free this slot yet, the queue is full
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      position = tail_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void AsyncSink::Publish(Slot &slot, std::uint64_t position) noexcept {
+  slot.sequence.store(position + 1, std::memory_order_release);
+  WakeDrain();
+}
+
+void AsyncSink::Flush() {
+  const std::uint64_t kTarget{tail_.load()};
+  while (head_.load() < kTarget && thread_.joinable()) {
+    WakeDrain();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  if (sink_) {
+    sink_->Flush();
+  }
+}
+
+void AsyncSink::RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context) {
+  Sink::RegisterLogger(logger, context);
+  if (sink_) {
+    sink_->RegisterLogger(logger, context);
+  }
+}
+
+std::uint64_t AsyncSink::GetDroppedCount() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+void AsyncSink::WakeDrain() noexcept {
+  // Pairs with the fence in Drain(): either the drain thread sees the new message or we see it sleeping
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (is_sleeping_.exchange(false)) {
+    wake_epoch_.fetch_add(1);
+    daal::af::sync::AtomicNotifyOne(wake_epoch_);
+  }
+}
+
+void AsyncSink::Drain() {
+  // Do not inherit a real-time policy of the creating thread
+  sched_param param{};
+  param.sched_priority = 0;
+  (void)pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+  for (;;) {
+    if (ShowQueued()) {
+      continue;
+    }
+    ReportDropped();
+    if (is_stopped_.load()) {
+      break;
+    }
+
+    const std::uint32_t kEpoch{wake_epoch_.load()};
+    is_sleeping_.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::uint64_t kHead{head_.load(std::memory_order_relaxed)};
+    const bool kIsEmpty{slots_[kHead & mask_].sequence.load(std::memory_order_acquire) != kHead + 1};
+    if (kIsEmpty && !is_stopped_.load()) {
+      daal::af::sync::AtomicWait(wake_epoch_, kEpoch);
+    }
+    is_sleeping_.store(false);
+  }
+}
+
+bool AsyncSink::ShowQueued() {
+  bool shown{false};
+  std::uint64_t head{head_.load(std::memory_order_relaxed)};
+  for (;;) {
+    Slot &slot{slots_[head & mask_]};
+    if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+      break;
+    }
+    if (slot.is_deferred && sink_->IsDeferred()) {
+      sink_->ShowDeferred(slot.log_level, slot.deferred);
+    } else if (slot.is_deferred) {
+      FormatDeferred(slot.deferred, slot.message);
+      sink_->ShowBuffer(slot.log_level, slot.message);
+    } else {
+      sink_->ShowBuffer(slot.log_level, slot.message);
+    }
+    slot.sequence.store(head + mask_ + 1, std::memory_order_release);
+    ++head;
+    head_.store(head, std::memory_order_release);
+    shown = true;
+  }
+  return shown;
+}
+
+void AsyncSink::ReportDropped() {
+  const std::uint64_t kDropped{dropped_.load(std::memory_order_relaxed)};
+  if (kDropped != reported_dropped_) {
+    MessageBuffer message{};
+    auto result = fmt::format_to_n(message.begin(), message.size() - 1, "{} log messages dropped",
+                                   kDropped - reported_dropped_);
+    *result.out = '\0';
+    sink_->ShowBuffer(LogLevel::kWarning, message);
+    reported_dropped_ = kDropped;
+  }
+}
+
+}  // namespace log
+}  // namespace daal
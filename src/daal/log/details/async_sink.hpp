@@ -0,0 +1,143 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_LOG_DETAILS_ASYNCSINK_H_
+#define SRC_DAAL_LOG_DETAILS_ASYNCSINK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "daal/log/sink.hpp"
+
+namespace daal {
+namespace log {
+
+/**
+ * @brief Sink decorator that decouples the logging thread from the output of another sink.
+ *
+ * ShowBuffer() copies the message into a preallocated ring and returns immediately; it neither allocates, locks nor
+ * waits. A drain thread running with the default, non real-time scheduling policy hands the messages to the wrapped
+ * sink. If the ring is full the message is dropped and counted, so a stalled output never delays the caller. The drain
+ * thread reports dropped messages as a warning on the wrapped sink once it caught up.
+ *
+ * The sink takes deferred messages, so the logging thread only copies the format string id and the raw arguments.
+ * Formatting happens on the drain thread, unless the wrapped sink takes deferred messages itself.
+ *
+ * \note The wrapped sink is only called from the drain thread, except for Flush().
+ */
+class AsyncSink : public Sink {
+ public:
+  /**
+   * @brief Construct the sink and start the drain thread.
+   * @param sink Sink showing the messages.
+   * @param capacity Number of messages that can be queued, rounded up to a power of two.
+   */
+  explicit AsyncSink(std::shared_ptr<Sink> sink, std::size_t capacity = config::kAsyncSinkCapacity);
+
+  /**
+   * @brief Show all queued messages and stop the drain thread.
+   */
+  ~AsyncSink() override;
+
+  AsyncSink(const AsyncSink &other) = delete;
+  AsyncSink(AsyncSink &&other) noexcept = delete;
+  AsyncSink &operator=(const AsyncSink &other) = delete;
+  AsyncSink &operator=(AsyncSink &&other) noexcept = delete;
+
+  /**
+   * @brief Queue the message for the drain thread, drop it if the queue is full.
+   */
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) override;
+
+  /**
+   * @brief Queue the unformatted message for the drain thread, drop it if the queue is full.
+   */
+  void ShowDeferred(LogLevel log_level, const DeferredMessage &message) override;
+
+  /**
+   * @brief Always true, formatting is left to the drain thread.
+   */
+  bool IsDeferred() const override;
+
+  /**
+   * @brief Wait until all messages queued so far are shown and flush the wrapped sink.
+   * \attention Blocks until the output caught up, do not call from a real-time thread.
+   */
+  void Flush() override;
+
+  /**
+   * @brief Register the logger for this sink and the wrapped sink.
+   */
+  void RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context) override;
+
+  /**
+   * @brief Number of messages dropped because the queue was full.
+   */
+  std::uint64_t GetDroppedCount() const noexcept;
+
+ private:
+  /** Queued message. */
+  struct Slot {
+    /** Position the slot is ready for: position to write, position + 1 to read. */
+    std::atomic<std::uint64_t> sequence{0};
+    LogLevel log_level{LogLevel::kUndefined};
+    bool is_deferred{false};
+    MessageBuffer message{};
+    DeferredMessage deferred{};
+  };
+
+  /** Claim the next free slot, returns nullptr and counts the message as dropped if the queue is full. */
+  Slot *Claim(std::uint64_t &position) noexcept;
+
+  /** Hand a filled slot to the drain thread. */
+  void Publish(Slot &slot, std::uint64_t position) noexcept;
+
+  /** Main loop of the drain thread. */
+  void Drain();
+
+  /** Show all queued messages, returns false if there were none. */
+  bool ShowQueued();
+
+  /** Report messages dropped since the last report. */
+  void ReportDropped();
+
+  /** Wake the drain thread if it is sleeping. */
+  void WakeDrain() noexcept;
+
+  std::shared_ptr<Sink> sink_;
+  std::unique_ptr<Slot[]> slots_;
+  std::size_t mask_;
+
+  /** Next position to write, shared by all producers. */
+  alignas(64) std::atomic<std::uint64_t> tail_{0};
+
+  /** Next position to read, written by the drain thread only. */
+  alignas(64) std::atomic<std::uint64_t> head_{0};
+
+  std::atomic<std::uint64_t> dropped_{0};
+  std::uint64_t reported_dropped_{0};
+
+  /** Bumped to wake the drain thread. */
+  std::atomic<std::uint32_t> wake_epoch_{0};
+  std::atomic<bool> is_sleeping_{false};
+  std::atomic<bool> is_stopped_{false};
+
+  std::thread thread_;
+};
+
+}  // namespace log
+}  // namespace daal
+
+#endif  // SRC_DAAL_LOG_DETAILS_ASYNCSINK_H_
@@ -0,0 +1,93 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "binary_file_sink.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "daal/log/format_registry.hpp"
+
+namespace daal {
+namespace log {
+
+BinaryFileSink::BinaryFileSink(const std::string &path) : file_{std::fopen(path.c_str(), "wb")}, is_good_{false} {
+  if (nullptr != file_) {
+    is_good_ = std::fwrite(kLogFileMagic.data(), kLogFileMagic.size(), 1, file_) == 1;
+  }
+}
+
+BinaryFileSink::~BinaryFileSink() {
+  if (nullptr != file_) {
+    std::fclose(file_);
+  }
+}
+
+void BinaryFileSink::ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) {
+  if (WouldShow(log_level)) {
+    const std::size_t kLength{strnlen(buffer.data(), buffer.size())};
+    std::lock_guard<std::mutex> lock{mutex_};
+    Write(LogRecordType::kText, log_level, FormatRegistry::kInvalidId, buffer.data(), kLength);
+  }
+}
+
+void BinaryFileSink::ShowDeferred(LogLevel log_level, const DeferredMessage &message) {
+  if (!WouldShow(log_level) || message.format_id >= config::kMaxFormatStrings) {
+    return;
+  }
+  // the format record has to precede the first message of its id in the file
+  std::lock_guard<std::mutex> lock{mutex_};
+  if (!defined_formats_.test(message.format_id)) {
+    const fmt::string_view kFormat{FormatRegistry::Get().Lookup(message.format_id)};
+    Write(LogRecordType::kFormat, log_level, message.format_id, kFormat.data(), kFormat.size());
+    defined_formats_.set(message.format_id);
+  }
+  Write(LogRecordType::kMessage, log_level, message.format_id, message.args.data(), message.size);
+}
+
+bool BinaryFileSink::IsDeferred() const { return true; }
+
+void BinaryFileSink::Flush() {
+  std::lock_guard<std::mutex> lock{mutex_};
+  if (nullptr != file_) {
+    std::fflush(file_);
+  }
+}
+
+void BinaryFileSink::RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context) {
+  Sink::RegisterLogger(logger, context);
+  std::lock_guard<std::mutex> lock{mutex_};
+  Write(LogRecordType::kContext, LogLevel::kUndefined, FormatRegistry::kInvalidId, context.data(),
+        std::min<std::size_t>(context.size(), UINT16_MAX));
+}
+
+bool BinaryFileSink::IsGood() const noexcept {
+  std::lock_guard<std::mutex> lock{mutex_};
+  return is_good_;
+}
+
+void BinaryFileSink::Write(LogRecordType type, LogLevel log_level, std::uint16_t format_id, const void *payload,
+                           std::size_t size) noexcept {
+  if (nullptr == file_) {
+    return;
+  }
+  const LogRecordHeader kHeader{type, log_level, format_id, static_cast<std::uint16_t>(size), 0};
+  bool success{std::fwrite(&kHeader, sizeof(kHeader), 1, file_) == 1};
+  if (success && size != 0) {
+    success = std::fwrite(payload, size, 1, file_) == 1;
+  }
+  is_good_ = is_good_ && success;
+}
+
+}  // namespace log
+}  // namespace daal
@@ -0,0 +1,115 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_LOG_DETAILS_BINARYFILESINK_H_
+#define SRC_DAAL_LOG_DETAILS_BINARYFILESINK_H_
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+#include "daal/log/sink.hpp"
+
+namespace daal {
+namespace log {
+
+/**
+ * @brief Types of the records of a binary log file.
+ */
+enum class LogRecordType : std::uint8_t {
+  kContext = 0,  ///< Context of the following messages, payload is the context.
+  kFormat = 1,   ///< Definition of a format string id, payload is the format string.
+  kMessage = 2,  ///< Deferred message, payload are the encoded arguments.
+  kText = 3,     ///< Message formatted by the caller, payload is the text.
+};
+
+/**
+ * @brief Header of every record of a binary log file, followed by size bytes of payload.
+ */
+struct LogRecordHeader {
+  LogRecordType type;
+  LogLevel log_level;
+  std::uint16_t format_id;
+  std::uint16_t size;
+  std::uint16_t reserved;
+};
+static_assert(sizeof(LogRecordHeader) == 8, "Log records are written as raw bytes");
+
+/** Magic bytes at the start of a binary log file. */
+constexpr std::array<char, 8> kLogFileMagic{'D', 'A', 'A', 'L', 'L', 'O', 'G', '1'};
+
+/**
+ * @brief Sink writing messages unformatted to a binary file, to be decoded with the log_decode tool.
+ *
+ * Deferred messages are stored as format string id and raw arguments. The format string of an id is written once,
+ * before its first message, so the file can be decoded by another process. Messages that could not be deferred are
+ * stored as text.
+ *
+ * \note The sink may be called from several logging threads, records are serialized by a mutex and written on the
+ * calling thread. Wrap it into an AsyncSink to keep the file output and the lock away from the logging threads.
+ */
+class BinaryFileSink : public Sink {
+ public:
+  /**
+   * @brief Create the file and write its header.
+   * @param path Path of the file, an existing file is overwritten.
+   */
+  explicit BinaryFileSink(const std::string &path);
+
+  ~BinaryFileSink() override;
+
+  BinaryFileSink(const BinaryFileSink &other) = delete;
+  BinaryFileSink(BinaryFileSink &&other) noexcept = delete;
+  BinaryFileSink &operator=(const BinaryFileSink &other) = delete;
+  BinaryFileSink &operator=(BinaryFileSink &&other) noexcept = delete;
+
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) override;
+
+  void ShowDeferred(LogLevel log_level, const DeferredMessage &message) override;
+
+  bool IsDeferred() const override;
+
+  void Flush() override;
+
+  /**
+   * @brief Register the logger and record its context in the file.
+   */
+  void RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context) override;
+
+  /**
+   * @brief Check whether the file was opened and all records were written successfully.
+   */
+  bool IsGood() const noexcept;
+
+ private:
+  /** Write one record, the mutex must be held. */
+  void Write(LogRecordType type, LogLevel log_level, std::uint16_t format_id, const void *payload,
+             std::size_t size) noexcept;
+
+  /** Serializes the records of all threads and guards the members below. */
+  mutable std::mutex mutex_;
+
+  std::FILE *file_;
+  bool is_good_;
+
+  /** Format string ids already defined in the file. */
+  std::bitset<config::kMaxFormatStrings> defined_formats_{};
+};
+
+}  // namespace log
+}  // namespace daal
+
+#endif  // SRC_DAAL_LOG_DETAILS_BINARYFILESINK_H_
@@ -0,0 +1,83 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include "format_registry.hpp"
+
+#include <cstring>
+
+namespace daal {
+namespace log {
+
+namespace {
+
+/** FNV-1a, the format strings are short. */
+std::uint64_t Hash(fmt::string_view text) noexcept {
+  std::uint64_t hash{14695981039346656037ULL};
+  for (const char kChar : text) {
+    hash ^= static_cast<std::uint8_t>(kChar);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
+FormatRegistry &FormatRegistry::Get() {
+  static FormatRegistry registry;
+  return registry;
+}
+
+std::uint16_t FormatRegistry::Intern(fmt::string_view format) noexcept {
+  const std::uint64_t kHash{Hash(format)};
+  for (std::size_t probe = 0; probe < entries_.size(); ++probe) {
+    const std::size_t kIdx{(kHash + probe) & (entries_.size() - 1)};
+    Entry &entry{entries_[kIdx]};
+    EntryState state{entry.state.load(std::memory_order_acquire)};
+
+    if (state == EntryState::kEmpty) {
+      if (entry.state.compare_exchange_strong(state, EntryState::kWriting, std::memory_order_acq_rel)) {
+        const std::size_t kOffset{storage_used_.fetch_add(format.size(), std::memory_order_relaxed)};
+        if (kOffset + format.size() > storage_.size()) {
+          // Out of storage, the entry stays reserved but never matches
+          entry.state.store(EntryState::kUnusable, std::memory_order_release);
+          return kInvalidId;
+        }
+        std::memcpy(&storage_[kOffset], format.data(), format.size());
+        entry.hash = kHash;
+        entry.data = &storage_[kOffset];
+        entry.size = format.size();
+        entry.state.store(EntryState::kReady, std::memory_order_release);
+        return static_cast<std::uint16_t>(kIdx);
+      }
+    }
+    // Another thread is registering this entry, it is done in a few instructions
+    while (state == EntryState::kWriting) {
+      state = entry.state.load(std::memory_order_acquire);
+    }
+    if (state == EntryState::kReady && entry.hash == kHash && entry.size == format.size() &&
+        std::memcmp(entry.data, format.data(), format.size()) == 0) {
+      return static_cast<std::uint16_t>(kIdx);
+    }
+  }
+  return kInvalidId;
+}
+
+fmt::string_view FormatRegistry::Lookup(std::uint16_t id) const noexcept {
+  if (id >= entries_.size() || entries_[id].state.load(std::memory_order_acquire) != EntryState::kReady) {
+    return {};
+  }
+  return {entries_[id].data, entries_[id].size};
+}
+
+}  // namespace log
+}  // namespace daal
@@ -0,0 +1,83 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#ifndef SRC_DAAL_LOG_FORMAT_REGISTRY_H_
+#define SRC_DAAL_LOG_FORMAT_REGISTRY_H_
+
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "daal/log/logger_types.hpp"
+
+namespace daal {
+namespace log {
+
+/**
+ * @brief Process wide table of format strings used by deferred messages.
+ *
+ * Every distinct format string gets a small id on first use, deferred messages store the id instead of the string.
+ * The registry keeps its own copy of the strings in fixed storage, so the id stays valid even for format strings
+ * built at runtime. Interning and lookup are lock-free and never allocate.
+ */
+class FormatRegistry {
+ public:
+  /** Id returned if the registry is full. */
+  static constexpr std::uint16_t kInvalidId{0xFFFF};
+
+  static_assert((config::kMaxFormatStrings & (config::kMaxFormatStrings - 1)) == 0,
+                "Number of format strings must be a power of two");
+  static_assert(config::kMaxFormatStrings < kInvalidId, "Format string ids must fit into 16 bits");
+
+  static FormatRegistry &Get();
+
+  FormatRegistry(const FormatRegistry &other) = delete;
+  FormatRegistry(FormatRegistry &&other) noexcept = delete;
+  FormatRegistry &operator=(const FormatRegistry &other) = delete;
+  FormatRegistry &operator=(FormatRegistry &&other) noexcept = delete;
+
+  /**
+   * @brief Return the id of the format string, registering it on first use.
+   * @return kInvalidId if the registry is full.
+   */
+  std::uint16_t Intern(fmt::string_view format) noexcept;
+
+  /**
+   * @brief Return the format string of an id, an empty string for unknown ids.
+   */
+  fmt::string_view Lookup(std::uint16_t id) const noexcept;
+
+ private:
+  FormatRegistry() = default;
+  ~FormatRegistry() = default;
+
+  enum class EntryState : std::uint32_t { kEmpty = 0, kWriting, kReady, kUnusable };
+
+  struct Entry {
+    std::atomic<EntryState> state{EntryState::kEmpty};
+    std::uint64_t hash{0};
+    const char *data{nullptr};
+    std::size_t size{0};
+  };
+
+  std::array<Entry, config::kMaxFormatStrings> entries_{};
+  std::array<char, config::kFormatStringStorage> storage_{};
+  std::atomic<std::size_t> storage_used_{0};
+};
+
+}  // namespace log
+}  // namespace daal
+
+#endif  // SRC_DAAL_LOG_FORMAT_REGISTRY_H_
@@ -13,6 +13,8 @@
 
 #include "logger.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <utility>
 
 #include "sink.hpp"
@@ -24,12 +26,22 @@ Logger::Logger(const std::string &context) : context_{std::move(context)} {}
 
 bool Logger::AddSink(const std::shared_ptr<Sink> &sink) {
   bool ret{true};
+  std::lock_guard<std::mutex> lock{sinks_mutex_};
+  const std::size_t kIdx{sinks_insert_idx_.load(std::memory_order_relaxed)};
 
-  if (sink && sinks_insert_idx_ != sinks_.size()) {
-    limit_of_all_sinks_ = std::min(limit_of_all_sinks_, sink->GetLogLevel());
+  if (sink && kIdx != sinks_.size()) {
     sink->RegisterLogger(shared_from_this(), context_);
-    sinks_[sinks_insert_idx_] = sink;
-    sinks_insert_idx_++;
+    sinks_[kIdx] = sink;
+    sinks_deferred_[kIdx] = sink->IsDeferred();
+    // Publish the sink before its limit lets messages through
+    sinks_insert_idx_.store(kIdx + 1, std::memory_order_release);
+    limit_of_all_sinks_.store(std::min(limit_of_all_sinks_.load(std::memory_order_relaxed), sink->GetLogLevel()),
+                              std::memory_order_relaxed);
+    if (sinks_deferred_[kIdx]) {
+      has_deferred_sinks_.store(true, std::memory_order_relaxed);
+    } else {
+      has_immediate_sinks_.store(true, std::memory_order_relaxed);
+    }
   } else {
     ret = false;
   }
@@ -38,41 +50,56 @@ bool Logger::AddSink(const std::shared_ptr<Sink> &sink) {
 }
 
 void Logger::UpdateSinkLimits() {
-  limit_of_all_sinks_ = LogLevel::kMax;
-  for (size_t idx = 0; idx != sinks_insert_idx_; idx++) {
-    const auto kSink = sinks_[idx];
-    if (kSink) {
-      limit_of_all_sinks_ = std::min(limit_of_all_sinks_, kSink->GetLogLevel());
+  std::lock_guard<std::mutex> lock{sinks_mutex_};
+  LogLevel limit{LogLevel::kMax};
+  const std::size_t kCount{sinks_insert_idx_.load(std::memory_order_relaxed)};
+  for (size_t idx = 0; idx != kCount; idx++) {
+    if (sinks_[idx]) {
+      limit = std::min(limit, sinks_[idx]->GetLogLevel());
     }
   }
+  limit_of_all_sinks_.store(limit, std::memory_order_relaxed);
 }
 
-void Logger::Enable() { is_enabled_ = true; }
+void Logger::Enable() { is_enabled_.store(true, std::memory_order_relaxed); }
 
-void Logger::Disable() { is_enabled_ = false; }
+void Logger::Disable() { is_enabled_.store(false, std::memory_order_relaxed); }
 
-bool Logger::IsEnabled() const { return is_enabled_; }
+bool Logger::IsEnabled() const { return is_enabled_.load(std::memory_order_relaxed); }
 
 bool Logger::WouldShow(LogLevel log_level) const {
   return IsEnabled() &&                          //
          log_level >= config::kLimitLogLevel &&  //
-         log_level >= limit_of_all_sinks_;
+         log_level >= limit_of_all_sinks_.load(std::memory_order_relaxed);
 }
 
 void Logger::Flush() {
-  for (size_t idx = 0; idx != sinks_insert_idx_; idx++) {
-    const auto kSink = sinks_[idx];
+  const std::size_t kCount{sinks_insert_idx_.load(std::memory_order_acquire)};
+  for (size_t idx = 0; idx != kCount; idx++) {
+    Sink *const kSink{sinks_[idx].get()};
     if (kSink) {
       kSink->Flush();
     }
   }
 }
 
-void Logger::ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) {
-  for (size_t idx = 0; idx != sinks_insert_idx_; idx++) {
-    const auto kSink = sinks_[idx];
-    if (kSink) {
-      kSink->ShowBuffer(log_level, buffer_);
+void Logger::ShowBuffer(LogLevel log_level, const MessageBuffer &buffer, bool include_deferred) {
+  // Published sinks are never modified, so they are read without copying the shared pointers
+  const std::size_t kCount{sinks_insert_idx_.load(std::memory_order_acquire)};
+  for (size_t idx = 0; idx != kCount; idx++) {
+    Sink *const kSink{sinks_[idx].get()};
+    if (kSink && (include_deferred || !sinks_deferred_[idx])) {
+      kSink->ShowBuffer(log_level, buffer);
+    }
+  }
+}
+
+void Logger::ShowDeferred(LogLevel log_level, const DeferredMessage &message) {
+  const std::size_t kCount{sinks_insert_idx_.load(std::memory_order_acquire)};
+  for (size_t idx = 0; idx != kCount; idx++) {
+    Sink *const kSink{sinks_[idx].get()};
+    if (kSink && sinks_deferred_[idx]) {
+      kSink->ShowDeferred(log_level, message);
     }
   }
 }
@@ -16,9 +16,13 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "daal/log/config/logger_config.hpp"
+#include "daal/log/deferred_message.hpp"
 #include "daal/log/logger_types.hpp"
 
 namespace daal {
@@ -38,16 +42,24 @@ class Sink;
  * possible to check if a message of a given log level would be shown. This is useful to do time consuming tasks only if
  * the result of the calculations would be shown at all.
  *
+ * Logging is thread-safe and lock-free: every call formats into a buffer on its own stack and the registered sinks are
+ * read without a lock. Sinks can only be added, never removed, so a sink seen by a logging thread stays valid. Adding
+ * sinks and changing limits is serialized by a mutex that is never taken while logging. Sinks called from several
+ * threads must be thread-safe themselves.
+ *
+ * Sinks reporting IsDeferred() get the message unformatted: the caller only stores the id of the format string and
+ * the raw arguments (see DeferredMessage), formatting happens later in the sink. Messages whose arguments cannot be
+ * encoded are formatted on the caller and passed to ShowBuffer() as usual.
  */
 class Logger : public std::enable_shared_from_this<Logger> {
  public:
   Logger() = delete;
   explicit Logger(const std::string &context);
   ~Logger() = default;
-  Logger(const Logger &other) = default;
-  Logger(Logger &&other) noexcept = default;
-  Logger &operator=(const Logger &other) = default;
-  Logger &operator=(Logger &&other) noexcept = default;
+  Logger(const Logger &other) = delete;
+  Logger(Logger &&other) noexcept = delete;
+  Logger &operator=(const Logger &other) = delete;
+  Logger &operator=(Logger &&other) noexcept = delete;
 
   /**
    * @brief Add a sink to the list of sinks.
@@ -190,28 +202,42 @@ class Logger : public std::enable_shared_from_this<Logger> {
   }
 
  private:
-  /** Static message buffer that is used by libfmt to generate the formatted log message. */
-  MessageBuffer buffer_{};
-
-  /** List of registered sinks. */
+  /** List of registered sinks. Entries below sinks_insert_idx_ are never modified again. */
   Sinks sinks_;
 
-  /** Index where the next registered sink would be added to the list of sinks. */
-  std::size_t sinks_insert_idx_{0};
+  /** Index where the next registered sink would be added to the list of sinks, published after the sink. */
+  std::atomic<std::size_t> sinks_insert_idx_{0};
+
+  /** Flags whether the sink of the same index takes deferred messages. */
+  std::array<bool, config::kMaxSinks> sinks_deferred_{};
+
+  /** Flag whether any registered sink takes deferred messages. */
+  std::atomic<bool> has_deferred_sinks_{false};
+
+  /** Flag whether any registered sink takes formatted messages only. */
+  std::atomic<bool> has_immediate_sinks_{false};
 
   /** Minimal severity over all sinks. */
-  LogLevel limit_of_all_sinks_{LogLevel::kMax};
+  std::atomic<LogLevel> limit_of_all_sinks_{LogLevel::kMax};
 
   /** Flag whether the logging facility is enabled. */
-  bool is_enabled_{true};
+  std::atomic<bool> is_enabled_{true};
+
+  /** Serializes changes of the sinks and their limits, never taken while logging. */
+  std::mutex sinks_mutex_;
 
   /** Context of this logger. */
   std::string context_;
 
   /**
-   * @brief Show the given buffer on all registered sinks.
+   * @brief Show the given buffer on all registered sinks, sinks taking deferred messages only if include_deferred.
    */
-  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer);
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer, bool include_deferred);
+
+  /**
+   * @brief Show the given deferred message on all registered sinks taking deferred messages.
+   */
+  void ShowDeferred(LogLevel log_level, const DeferredMessage &message);
 
   /**
    * @brief Determine if logging of the given severity and sensitivity is desired.
@@ -228,11 +254,27 @@ class Logger : public std::enable_shared_from_this<Logger> {
   inline typename std::enable_if<IsLoggingDesired(LogLevel, LogSensitivity), void>::type LogInternal(
       fmt::format_string<T...> fmt, T &&...args) {
     if (WouldShow(LogLevel)) {
-      auto result = fmt::format_to_n(buffer_.begin(), buffer_.size(), fmt, std::forward<T>(args)...);
-
-      const std::size_t kIdx = std::min(result.size, buffer_.size() - 1);
-      buffer_[kIdx] = '\0';
-      ShowBuffer(LogLevel, buffer_);
+      bool include_deferred{true};
+      if constexpr (kIsDeferrable<T...>) {
+        if (has_deferred_sinks_.load(std::memory_order_relaxed)) {
+          DeferredMessage message;
+          if (EncodeDeferred(message, fmt::string_view{fmt}, args...)) {
+            ShowDeferred(LogLevel, message);
+            include_deferred = false;
+            if (!has_immediate_sinks_.load(std::memory_order_relaxed)) {
+              return;
+            }
+          }
+        }
+      }
+
+      // Buffer per call, concurrent calls never share it
+      MessageBuffer buffer;
+      auto result = fmt::format_to_n(buffer.begin(), buffer.size(), fmt, std::forward<T>(args)...);
+
+      const std::size_t kIdx = std::min(result.size, buffer.size() - 1);
+      buffer[kIdx] = '\0';
+      ShowBuffer(LogLevel, buffer, include_deferred);
     }
   }
 
@@ -27,6 +27,18 @@ constexpr std::size_t kMaxLogMessageBufferLength{200};
 
 /** Maximum number of sinks for each logging facility. */
 constexpr std::size_t kMaxSinks{4};
+
+/** Default number of messages queued by an AsyncSink, must be a power of two. */
+constexpr std::size_t kAsyncSinkCapacity{256};
+
+/** Maximum size of the encoded arguments of a message whose formatting is deferred. */
+constexpr std::size_t kMaxDeferredArgBytes{128};
+
+/** Maximum number of distinct format strings of deferred messages, must be a power of two. */
+constexpr std::size_t kMaxFormatStrings{1024};
+
+/** Storage for the format strings of deferred messages [bytes]. */
+constexpr std::size_t kFormatStringStorage{65536};
 }  // namespace config
 
 /** Type for message buffer. */
@@ -30,6 +30,14 @@ void Sink::SetLogLevel(LogLevel log_level) {
   }
 }
 
+void Sink::ShowDeferred(LogLevel log_level, const DeferredMessage& message) {
+  MessageBuffer buffer;
+  FormatDeferred(message, buffer);
+  ShowBuffer(log_level, buffer);
+}
+
+bool Sink::IsDeferred() const { return false; }
+
 const std::string& Sink::GetContext() const { return context_; }
 
 LogLevel Sink::GetLogLevel() const { return log_level_; }
@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include "daal/log/config/logger_config.hpp"
+#include "daal/log/deferred_message.hpp"
 #include "daal/log/logger_types.hpp"
 
 namespace daal {
@@ -43,6 +44,18 @@ class Sink {
    */
   virtual void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) = 0;
 
+  /**
+   * @brief Method called by the logger facility to show a message that is not formatted yet.
+   *
+   * Only called if IsDeferred() returns true. The default implementation formats the message and calls ShowBuffer().
+   */
+  virtual void ShowDeferred(LogLevel log_level, const DeferredMessage &message);
+
+  /**
+   * @brief Check whether this sink takes deferred messages, the logger then skips formatting them on the caller.
+   */
+  virtual bool IsDeferred() const;
+
   /**
    * @brief Method called by the logging facility to ensure that all buffers are
    * flushed to their destination.
@@ -52,7 +65,7 @@ class Sink {
   /**
    * @brief Register logger for callbacks.
    */
-  void RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context);
+  virtual void RegisterLogger(const std::shared_ptr<Logger> &logger, std::string &context);
 
   /**
    * @brief Get the context of this sink.
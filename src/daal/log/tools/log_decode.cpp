@@ -0,0 +1,100 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+/**
+ * Decodes a log file written by daal::log::BinaryFileSink.
+ *
+ * Usage: log_decode <log file>
+ *
+ * Prints the messages in the order they were written, one message per line:
+ * [<context>][<level>] <message>
+ */
+
+#include <fmt/core.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "daal/log/deferred_message.hpp"
+#include "daal/log/details/binary_file_sink.hpp"
+
+namespace {
+
+template <typename T>
+bool Read(std::FILE *file, T *value, std::size_t count = 1) {
+  return count == 0 || std::fread(value, sizeof(T), count, file) == count;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    fmt::print(stderr, "Usage: {} <log file>\n", argv[0]);
+    return 1;
+  }
+  std::FILE *file{std::fopen(argv[1], "rb")};
+  if (nullptr == file) {
+    fmt::print(stderr, "Cannot open {}\n", argv[1]);
+    return 1;
+  }
+
+  std::array<char, 8> magic{};
+  if (!Read(file, magic.data(), magic.size()) || magic != daal::log::kLogFileMagic) {
+    fmt::print(stderr, "{} is not a log file of this version\n", argv[1]);
+    std::fclose(file);
+    return 1;
+  }
+
+  std::string context;
+  std::vector<std::string> formats;
+  std::vector<std::uint8_t> payload;
+  daal::log::MessageBuffer buffer{};
+  daal::log::LogRecordHeader header{};
+  while (Read(file, &header)) {
+    payload.resize(header.size);
+    if (!Read(file, payload.data(), payload.size())) {
+      fmt::print(stderr, "Truncated log file\n");
+      std::fclose(file);
+      return 1;
+    }
+    const std::string kText{payload.begin(), payload.end()};
+    switch (header.type) {
+      case daal::log::LogRecordType::kContext:
+        context = kText;
+        break;
+      case daal::log::LogRecordType::kFormat:
+        if (header.format_id >= formats.size()) {
+          formats.resize(header.format_id + 1U);
+        }
+        formats[header.format_id] = kText;
+        break;
+      case daal::log::LogRecordType::kMessage: {
+        const std::string kFormat{header.format_id < formats.size() ? formats[header.format_id] : std::string{}};
+        daal::log::FormatDeferred(kFormat, payload.data(), payload.size(), buffer.data(), buffer.size());
+        fmt::print("[{}][{}] {}\n", context, daal::log::GetLevelName(header.log_level), buffer.data());
+        break;
+      }
+      case daal::log::LogRecordType::kText:
+        fmt::print("[{}][{}] {}\n", context, daal::log::GetLevelName(header.log_level), kText);
+        break;
+      default:
+        fmt::print(stderr, "Unknown record type {}\n", static_cast<unsigned>(header.type));
+        break;
+    }
+  }
+  std::fclose(file);
+  return 0;
+}
@@ -0,0 +1,106 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "daal/af/app_base/buffered_iohandler.hpp"
+#include "daal/af/sync/data_ready_signal.hpp"
+
+using daal::af::app_base::BufferedIoHandler;
+using daal::af::app_base::IoHandler;
+
+namespace {
+
+struct Request {
+  std::uint16_t angle{0};
+  std::uint8_t mode{0};
+};
+
+/** Loops its outputs back as inputs, receiving and sending are driven by the test. */
+class LoopbackIoHandler : public BufferedIoHandler<Request, Request> {
+ public:
+  ConnectionState Start() override {
+    SetConnectionState(ConnectionState::kConnected);
+    return ConnectionState::kConnected;
+  }
+  void Stop() override {}
+
+  void Receive(std::uint16_t angle) {
+    GetInputBackBuffer() = Request{angle, 1};
+    PublishInput();
+  }
+
+  bool Send() {
+    if (!ConsumeOutput()) {
+      return false;
+    }
+    sent_ = GetPublishedOutput();
+    return true;
+  }
+
+  const Request& GetSent() const { return sent_; }
+
+ private:
+  Request sent_{};
+};
+
+}  // namespace
+
+TEST(BufferedIoHandlerTest, StepSeesSnapshotOfLatestInput) {
+  LoopbackIoHandler handler;
+  handler.PrepareStep();
+  EXPECT_FALSE(handler.HasNewInput());
+  EXPECT_EQ(handler.GetInput().angle, 0);
+
+  handler.Receive(10);
+  handler.Receive(20);
+  handler.PrepareStep();
+  EXPECT_TRUE(handler.HasNewInput());
+  const Request* snapshot{&handler.GetInput()};
+  EXPECT_EQ(snapshot->angle, 20);
+
+  // arriving during the step does not change the snapshot
+  handler.Receive(30);
+  EXPECT_EQ(snapshot->angle, 20);
+  EXPECT_EQ(&handler.GetInput(), snapshot);
+
+  handler.PrepareStep();
+  EXPECT_EQ(handler.GetInput().angle, 30);
+  handler.PrepareStep();
+  EXPECT_FALSE(handler.HasNewInput());
+  EXPECT_EQ(handler.GetInput().angle, 30);
+}
+
+TEST(BufferedIoHandlerTest, FinalizeStepPublishesOutput) {
+  LoopbackIoHandler handler;
+  EXPECT_FALSE(handler.Send());
+
+  handler.GetOutput() = Request{42, 2};
+  handler.FinalizeStep();
+  EXPECT_TRUE(handler.Send());
+  EXPECT_EQ(handler.GetSent().angle, 42);
+  EXPECT_EQ(handler.GetSent().mode, 2);
+  EXPECT_FALSE(handler.Send());
+}
+
+TEST(BufferedIoHandlerTest, PublishingInputNotifiesDataReadySignal) {
+  LoopbackIoHandler handler;
+  daal::af::sync::DataReadySignal signal;
+  handler.SetDataReadySignal(&signal);
+  const auto kEpoch = signal.GetEpoch();
+
+  handler.Receive(1);
+  EXPECT_NE(signal.GetEpoch(), kEpoch);
+}
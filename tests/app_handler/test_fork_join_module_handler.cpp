@@ -14,7 +14,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
-#include "app_handler/details/fork_join_module_handler.hpp"
+#include <mutex>
+#include <vector>
+
+#include "daal/af/app_handler/details/fork_join_module_handler.hpp"
 
 using namespace daal::af::app_handler;
 using ::testing::NiceMock;
@@ -119,3 +122,186 @@ TEST_F(ForkJoinModuleHandlerTest, ShutdownFailure) {
 
   EXPECT_FALSE(handler->Shutdown());
 }
+
+TEST(ForkJoinModuleHandlerPoolTest, ExecuteSpreadsModulesOverWorkers) {
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  ForkJoinModuleHandler::PhaseConfigList stage;
+  for (int idx = 0; idx < 8; ++idx) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    EXPECT_CALL(*module, Execute()).WillOnce(Return(true));
+    stage.push_back({ForkJoinModuleHandler::TaskAffinity::ANY, module});
+    modules.push_back(module);
+  }
+  auto pinned = std::make_shared<NiceMock<MockApplicationModule>>();
+  EXPECT_CALL(*pinned, Execute()).WillOnce(Return(true));
+  stage.push_back({ForkJoinModuleHandler::TaskAffinity::WORKER, pinned, 1});
+
+  ForkJoinModuleHandler handler({0, 1}, 0, {{ForkJoinModuleHandler::Stage::STAGE1, stage}});
+
+  EXPECT_TRUE(handler.Execute());
+}
+
+TEST(ForkJoinModuleHandlerPoolTest, ExecuteReportsFailureOfStealableModule) {
+  auto good = std::make_shared<NiceMock<MockApplicationModule>>();
+  auto bad = std::make_shared<NiceMock<MockApplicationModule>>();
+  EXPECT_CALL(*good, Execute()).WillOnce(Return(true));
+  EXPECT_CALL(*bad, Execute()).WillOnce(Return(false));
+
+  ForkJoinModuleHandler handler({0, 1}, 0,
+                                {{ForkJoinModuleHandler::Stage::STAGE1,
+                                  {{ForkJoinModuleHandler::TaskAffinity::ANY, good},
+                                   {ForkJoinModuleHandler::TaskAffinity::ANY, bad}}}});
+
+  EXPECT_FALSE(handler.Execute());
+}
+
+TEST(ForkJoinModuleHandlerPoolTest, InvalidWorkerIndexShouldDie) {
+  auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+  EXPECT_EXIT(
+      {
+        ForkJoinModuleHandler handler({0}, 0,
+                                      {{ForkJoinModuleHandler::Stage::STAGE1,
+                                        {{ForkJoinModuleHandler::TaskAffinity::WORKER, module, 3}}}});
+      },
+      testing::ExitedWithCode(42), "");
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, StagesRunInOrder) {
+  std::vector<int> order;
+  std::mutex mutex;
+  ForkJoinModuleHandler::StageList stages;
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  for (int stage = 0; stage < 5; ++stage) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    EXPECT_CALL(*module, Execute()).WillOnce([&order, &mutex, stage]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(stage);
+      return true;
+    });
+    stages.push_back({{ForkJoinModuleHandler::TaskAffinity::ANY, module}});
+    modules.push_back(module);
+  }
+
+  ForkJoinModuleHandler handler({0, 1}, 0, stages);
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, ForkMapStagesRunInEnumOrder) {
+  std::vector<int> order;
+  std::mutex mutex;
+  ForkJoinModuleHandler::ForkMap fork_map;
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  const std::vector<ForkJoinModuleHandler::Stage> kStages{ForkJoinModuleHandler::Stage::STAGE3,
+                                                          ForkJoinModuleHandler::Stage::STAGE1,
+                                                          ForkJoinModuleHandler::Stage::STAGE2};
+  for (const auto stage : kStages) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    EXPECT_CALL(*module, Execute()).WillOnce([&order, &mutex, stage]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(static_cast<int>(stage));
+      return true;
+    });
+    fork_map[stage] = {{ForkJoinModuleHandler::TaskAffinity::WORKER, module, 0}};
+    modules.push_back(module);
+  }
+
+  ForkJoinModuleHandler handler({0}, 0, fork_map);
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, ExplicitDependenciesAreRespected) {
+  std::vector<int> order;
+  std::mutex mutex;
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  for (int idx = 0; idx < 3; ++idx) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    EXPECT_CALL(*module, Execute()).WillOnce([&order, &mutex, idx]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(idx);
+      return true;
+    });
+    modules.push_back(module);
+  }
+  // 2 -> 0 -> 1
+  ForkJoinModuleHandler::ModuleGraph graph{{ForkJoinModuleHandler::TaskAffinity::ANY, modules[0], 0, {2}},
+                                           {ForkJoinModuleHandler::TaskAffinity::MAIN, modules[1], 0, {0}},
+                                           {ForkJoinModuleHandler::TaskAffinity::WORKER, modules[2], 1, {}}};
+
+  ForkJoinModuleHandler handler({0, 1}, 0, graph);
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_EQ(order, (std::vector<int>{2, 0, 1}));
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, LifecycleFollowsDependencyOrder) {
+  std::vector<int> order;
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  for (int idx = 0; idx < 2; ++idx) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    EXPECT_CALL(*module, Initialize()).WillOnce([&order, idx]() {
+      order.push_back(idx);
+      return true;
+    });
+    modules.push_back(module);
+  }
+  ForkJoinModuleHandler::ModuleGraph graph{{ForkJoinModuleHandler::TaskAffinity::ANY, modules[0], 0, {1}},
+                                           {ForkJoinModuleHandler::TaskAffinity::ANY, modules[1], 0, {}}};
+
+  ForkJoinModuleHandler handler({0}, 0, graph);
+
+  EXPECT_TRUE(handler.Initialize());
+  EXPECT_EQ(order, (std::vector<int>{1, 0}));
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, CyclicGraphShouldDie) {
+  auto first = std::make_shared<NiceMock<MockApplicationModule>>();
+  auto second = std::make_shared<NiceMock<MockApplicationModule>>();
+  ForkJoinModuleHandler::ModuleGraph graph{{ForkJoinModuleHandler::TaskAffinity::ANY, first, 0, {1}},
+                                           {ForkJoinModuleHandler::TaskAffinity::ANY, second, 0, {0}}};
+  EXPECT_EXIT({ ForkJoinModuleHandler handler({0}, 0, graph); }, testing::ExitedWithCode(42), "");
+}
+
+TEST(ForkJoinModuleHandlerGraphTest, InvalidDependencyShouldDie) {
+  auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+  ForkJoinModuleHandler::ModuleGraph graph{{ForkJoinModuleHandler::TaskAffinity::ANY, module, 0, {5}}};
+  EXPECT_EXIT({ ForkJoinModuleHandler handler({0}, 0, graph); }, testing::ExitedWithCode(42), "");
+}
+
+TEST(ForkJoinModuleHandlerDegradationTest, ShedModulesAreSkippedByLevel) {
+  auto required = std::make_shared<NiceMock<MockApplicationModule>>();
+  auto optional = std::make_shared<NiceMock<MockApplicationModule>>();
+  auto low_priority = std::make_shared<NiceMock<MockApplicationModule>>();
+  // the dependent of a shed module still runs
+  ForkJoinModuleHandler::ModuleGraph graph{{ForkJoinModuleHandler::TaskAffinity::ANY, low_priority, 0, {}, 2},
+                                           {ForkJoinModuleHandler::TaskAffinity::ANY, optional, 0, {0}, 1},
+                                           {ForkJoinModuleHandler::TaskAffinity::MAIN, required, 0, {1}}};
+  ForkJoinModuleHandler handler({0}, 0, graph);
+
+  EXPECT_CALL(*required, Execute()).Times(3).WillRepeatedly(Return(true));
+  EXPECT_CALL(*optional, Execute()).Times(1).WillRepeatedly(Return(true));
+  EXPECT_CALL(*low_priority, Execute()).Times(2).WillRepeatedly(Return(true));
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_TRUE(handler.SetDegradationLevel(1));
+  EXPECT_EQ(handler.GetDegradationLevel(), 1U);
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_TRUE(handler.SetDegradationLevel(2));
+  EXPECT_TRUE(handler.Execute());
+}
+
+TEST(ForkJoinModuleHandlerDegradationTest, RecoveredLevelRunsShedModulesAgain) {
+  auto optional = std::make_shared<NiceMock<MockApplicationModule>>();
+  ForkJoinModuleHandler::StageList stages{{{ForkJoinModuleHandler::TaskAffinity::ANY, optional, 0, 1}}};
+  ForkJoinModuleHandler handler({0}, 0, stages);
+
+  EXPECT_CALL(*optional, Execute()).Times(1).WillRepeatedly(Return(false));
+
+  EXPECT_TRUE(handler.SetDegradationLevel(5));
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_TRUE(handler.SetDegradationLevel(0));
+  EXPECT_FALSE(handler.Execute());
+}
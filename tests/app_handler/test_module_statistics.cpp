@@ -0,0 +1,167 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "daal/af/app_handler/details/fork_join_module_handler.hpp"
+#include "daal/af/app_handler/details/sequential_list_container.hpp"
+#include "daal/af/app_handler/details/sequential_list_handler.hpp"
+#include "daal/af/runtime_statistics/reporting_backend.hpp"
+
+using namespace daal::af::app_handler;
+using daal::af::runtime_statistics::IReportingBackend;
+using daal::af::runtime_statistics::RuntimeStatistics;
+using daal::af::runtime_statistics::TimeProvider;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+class MockApplicationModule : public IApplicationHandler {
+ public:
+  MOCK_METHOD(bool, Initialize, (), (override));
+  MOCK_METHOD(bool, PrepareForExecute, (), (override));
+  MOCK_METHOD(bool, Execute, (), (override));
+  MOCK_METHOD(bool, PrepareForShutdown, (), (override));
+  MOCK_METHOD(bool, Shutdown, (), (override));
+};
+
+class MockSafeApplication : public daal::af::app_base::SafeApplicationBase {
+ public:
+  MOCK_METHOD(daal::af::app_base::MethodState, OnInitialize, (), (override));
+  MOCK_METHOD(daal::af::app_base::MethodState, OnStart, (), (override));
+  MOCK_METHOD(daal::af::app_base::MethodState, Step, (), (override));
+  MOCK_METHOD(daal::af::app_base::MethodState, OnStop, (), (override));
+  MOCK_METHOD(daal::af::app_base::MethodState, OnTerminate, (), (override));
+};
+
+/** Every clock read advances the time by 10 µs. */
+class SteppingTimeProvider : public TimeProvider {
+ public:
+  std::uint64_t GetRealTime() noexcept override { return now_ += 10; }
+  std::uint64_t GetCPUTime() noexcept override { return now_ += 10; }
+
+ private:
+  std::atomic<std::uint64_t> now_{0};
+};
+
+class RecordingBackend : public IReportingBackend {
+ public:
+  void Show(const RuntimeStatistics::Statistics& statistics) noexcept override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    names_.push_back(statistics.name);
+  }
+
+  std::vector<std::string> Names() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> names_;
+};
+
+}  // namespace
+
+class ModuleStatisticsTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<SteppingTimeProvider> time_provider{std::make_shared<SteppingTimeProvider>()};
+  std::shared_ptr<RecordingBackend> backend{std::make_shared<RecordingBackend>()};
+};
+
+TEST_F(ModuleStatisticsTest, DisabledByDefault) {
+  auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+  ON_CALL(*module, Execute()).WillByDefault(Return(true));
+  SequentialAppHandlerContainer handler({module});
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_FALSE(handler.GetModuleStatistics().IsEnabled());
+  EXPECT_EQ(handler.GetModuleStatistics().Get(0), nullptr);
+}
+
+TEST_F(ModuleStatisticsTest, SequentialContainerMeasuresEveryModule) {
+  auto first = std::make_shared<NiceMock<MockApplicationModule>>();
+  auto second = std::make_shared<NiceMock<MockApplicationModule>>();
+  ON_CALL(*first, Execute()).WillByDefault(Return(true));
+  ON_CALL(*second, Execute()).WillByDefault(Return(true));
+  {
+    SequentialAppHandlerContainer handler({first, second});
+    handler.EnableModuleStatistics("container", time_provider, backend, 0.0F);
+
+    for (int cycle = 0; cycle < 5; ++cycle) {
+      EXPECT_TRUE(handler.Execute());
+    }
+
+    auto& statistics = handler.GetModuleStatistics();
+    ASSERT_EQ(statistics.Size(), 2U);
+    // the first cycle only provides the start time of the delta time
+    EXPECT_EQ(statistics.Get(0)->Get().cycle_count, 4U);
+    EXPECT_EQ(statistics.Get(1)->Get().cycle_count, 4U);
+    EXPECT_EQ(statistics.Get(1)->Get().name, "container.1");
+    EXPECT_GT(statistics.Get(0)->Get().gross_execution_time.mean, 0.0F);
+  }
+  // reported through the backend when the handler is destroyed
+  EXPECT_EQ(backend->Names(), (std::vector<std::string>{"container.0", "container.1"}));
+}
+
+TEST_F(ModuleStatisticsTest, SequentialListMeasuresEveryApplication) {
+  auto app = std::make_shared<NiceMock<MockSafeApplication>>();
+  ON_CALL(*app, Step()).WillByDefault(Return(daal::af::app_base::MethodState::kSuccessful));
+  SequentialListAppHandler handler(SequentialListAppHandler::AppList{app});
+  handler.EnableModuleStatistics("list", time_provider, backend, 0.0F);
+
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    EXPECT_TRUE(handler.Execute());
+  }
+
+  EXPECT_EQ(handler.GetModuleStatistics().Get(0)->Get().cycle_count, 2U);
+}
+
+TEST_F(ModuleStatisticsTest, ForkJoinMeasuresModulesOnWorkers) {
+  std::vector<std::shared_ptr<NiceMock<MockApplicationModule>>> modules;
+  ForkJoinModuleHandler::StageList stages(2);
+  for (int idx = 0; idx < 4; ++idx) {
+    auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+    ON_CALL(*module, Execute()).WillByDefault(Return(true));
+    stages[idx % 2].push_back({ForkJoinModuleHandler::TaskAffinity::ANY, module});
+    modules.push_back(module);
+  }
+  ForkJoinModuleHandler handler({0, 1}, 0, stages);
+  handler.EnableModuleStatistics("forkjoin", time_provider, backend, 0.0F);
+
+  for (int cycle = 0; cycle < 6; ++cycle) {
+    EXPECT_TRUE(handler.Execute());
+  }
+
+  auto& statistics = handler.GetModuleStatistics();
+  ASSERT_EQ(statistics.Size(), 4U);
+  for (std::size_t module = 0; module < statistics.Size(); ++module) {
+    EXPECT_EQ(statistics.Get(module)->Get().cycle_count, 5U);
+  }
+}
+
+TEST_F(ModuleStatisticsTest, FailureIsPassedThrough) {
+  auto module = std::make_shared<NiceMock<MockApplicationModule>>();
+  ON_CALL(*module, Execute()).WillByDefault(Return(false));
+  SequentialAppHandlerContainer handler({module});
+  handler.EnableModuleStatistics("failing", time_provider, backend, 0.0F);
+
+  EXPECT_FALSE(handler.Execute());
+}
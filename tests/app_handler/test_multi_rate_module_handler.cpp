@@ -0,0 +1,169 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "daal/af/app_handler/details/multi_rate_module_handler.hpp"
+
+using daal::af::app_handler::IApplicationHandler;
+using daal::af::app_handler::MultiRateModuleHandler;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace {
+
+/** Module recording its executions into a shared trace. */
+class RecordingModule : public IApplicationHandler {
+ public:
+  RecordingModule(int id, std::vector<int> &trace, std::mutex &mutex) : id_{id}, trace_{trace}, mutex_{mutex} {}
+
+  bool Initialize() override { return true; }
+  bool PrepareForExecute() override { return true; }
+  bool Execute() override {
+    std::lock_guard<std::mutex> lock{mutex_};
+    trace_.push_back(id_);
+    thread_ = std::this_thread::get_id();
+    return true;
+  }
+  bool PrepareForShutdown() override { return true; }
+  bool Shutdown() override { return true; }
+
+  std::thread::id Thread() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return thread_;
+  }
+
+ private:
+  int id_;
+  std::vector<int> &trace_;
+  std::mutex &mutex_;
+  std::thread::id thread_{};
+};
+
+class MultiRateModuleHandlerTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<RecordingModule> Module(int id) { return std::make_shared<RecordingModule>(id, trace_, mutex_); }
+
+  std::vector<int> Count(std::size_t modules) {
+    std::vector<int> counts(modules, 0);
+    for (const auto id : trace_) {
+      ++counts[static_cast<std::size_t>(id)];
+    }
+    return counts;
+  }
+
+  std::vector<int> trace_;
+  std::mutex mutex_;
+};
+
+}  // namespace
+
+TEST_F(MultiRateModuleHandlerTest, ComputesBasePeriodAndHyperperiod) {
+  MultiRateModuleHandler handler{{0},
+                                 0,
+                                 {{MultiRateModuleHandler::TaskAffinity::MAIN, Module(0), milliseconds(10)},
+                                  {MultiRateModuleHandler::TaskAffinity::MAIN, Module(1), milliseconds(4)},
+                                  {MultiRateModuleHandler::TaskAffinity::MAIN, Module(2), milliseconds(6)}}};
+
+  EXPECT_EQ(handler.GetBasePeriod(), milliseconds(2));
+  EXPECT_EQ(handler.GetHyperperiod(), milliseconds(60));
+}
+
+TEST_F(MultiRateModuleHandlerTest, RunsModulesAtTheirRates) {
+  MultiRateModuleHandler handler{{0},
+                                 0,
+                                 {{MultiRateModuleHandler::TaskAffinity::MAIN, Module(0), milliseconds(1)},
+                                  {MultiRateModuleHandler::TaskAffinity::WORKER, Module(1), milliseconds(10)},
+                                  {MultiRateModuleHandler::TaskAffinity::ANY, Module(2), milliseconds(100)}}};
+  ASSERT_EQ(handler.GetBasePeriod(), milliseconds(1));
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  for (int tick = 0; tick < 200; ++tick) {
+    ASSERT_TRUE(handler.Execute());
+  }
+
+  EXPECT_EQ(Count(3), (std::vector<int>{200, 20, 2}));
+}
+
+TEST_F(MultiRateModuleHandlerTest, OffsetShiftsReleaseTime) {
+  MultiRateModuleHandler handler{
+      {0},
+      0,
+      {{MultiRateModuleHandler::TaskAffinity::MAIN, Module(0), milliseconds(2)},
+       {MultiRateModuleHandler::TaskAffinity::MAIN, Module(1), milliseconds(10), milliseconds(5)}}};
+
+  EXPECT_EQ(handler.GetBasePeriod(), milliseconds(1));
+  EXPECT_TRUE(handler.GetDueModules(0) == (std::vector<std::size_t>{0}));
+  EXPECT_TRUE(handler.GetDueModules(1).empty());
+  EXPECT_TRUE(handler.GetDueModules(5) == (std::vector<std::size_t>{1}));
+  EXPECT_TRUE(handler.GetDueModules(15) == (std::vector<std::size_t>{1}));
+  EXPECT_TRUE(handler.GetDueModules(16) == (std::vector<std::size_t>{0}));
+}
+
+TEST_F(MultiRateModuleHandlerTest, DispatchesRateMonotonic) {
+  auto slow = Module(0);
+  auto fast = Module(1);
+  MultiRateModuleHandler handler{{0},
+                                 0,
+                                 {{MultiRateModuleHandler::TaskAffinity::MAIN, slow, milliseconds(20)},
+                                  {MultiRateModuleHandler::TaskAffinity::MAIN, fast, milliseconds(5)}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  ASSERT_TRUE(handler.Execute());
+
+  EXPECT_EQ(trace_, (std::vector<int>{1, 0}));
+  EXPECT_EQ(slow->Thread(), std::this_thread::get_id());
+}
+
+TEST_F(MultiRateModuleHandlerTest, RunsWorkerModulesOnWorker) {
+  auto module = Module(0);
+  MultiRateModuleHandler handler{{0}, 0, {{MultiRateModuleHandler::TaskAffinity::WORKER, module, microseconds(500)}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  ASSERT_TRUE(handler.Execute());
+
+  EXPECT_NE(module->Thread(), std::this_thread::get_id());
+}
+
+TEST_F(MultiRateModuleHandlerTest, PrepareForExecuteRestartsSchedule) {
+  MultiRateModuleHandler handler{{0},
+                                 0,
+                                 {{MultiRateModuleHandler::TaskAffinity::MAIN, Module(0), milliseconds(1)},
+                                  {MultiRateModuleHandler::TaskAffinity::MAIN, Module(1), milliseconds(3)}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+  ASSERT_TRUE(handler.Execute());
+  ASSERT_TRUE(handler.PrepareForExecute());
+  ASSERT_TRUE(handler.Execute());
+
+  EXPECT_EQ(Count(2), (std::vector<int>{2, 2}));
+}
+
+TEST_F(MultiRateModuleHandlerTest, InvalidOffsetTerminates) {
+  EXPECT_EXIT(
+      (MultiRateModuleHandler{
+          {0}, 0, {{MultiRateModuleHandler::TaskAffinity::MAIN, Module(0), milliseconds(5), milliseconds(5)}}}),
+      ::testing::ExitedWithCode(42), "");
+}
+
+TEST_F(MultiRateModuleHandlerTest, InvalidWorkerTerminates) {
+  EXPECT_EXIT((MultiRateModuleHandler{
+                  {0}, 0, {{MultiRateModuleHandler::TaskAffinity::WORKER, Module(0), milliseconds(5), {}, 1}}}),
+              ::testing::ExitedWithCode(42), "");
+}
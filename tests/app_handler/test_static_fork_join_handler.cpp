@@ -0,0 +1,137 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "daal/af/app_handler/details/static_fork_join_handler.hpp"
+
+using namespace daal::af::app_handler;
+
+namespace {
+
+/** Shared record of the module calls of a test. */
+struct CallLog {
+  std::mutex mutex;
+  std::vector<int> calls;
+  std::vector<std::thread::id> threads;
+
+  void Record(int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    calls.push_back(id);
+    threads.push_back(std::this_thread::get_id());
+  }
+};
+
+/** Module identified by its template argument, logs into a global log. */
+template <int kId, bool kSucceeds = true>
+class LoggingModule {
+ public:
+  static CallLog *log;
+
+  bool Initialize() {
+    log->Record(kId);
+    return true;
+  }
+  bool PrepareForExecute() { return true; }
+  bool Execute() {
+    log->Record(kId);
+    return kSucceeds;
+  }
+  bool PrepareForShutdown() { return true; }
+  bool Shutdown() { return kSucceeds; }
+};
+
+template <int kId, bool kSucceeds>
+CallLog *LoggingModule<kId, kSucceeds>::log{nullptr};
+
+template <typename... Modules>
+void SetLog(CallLog *log) {
+  ((Modules::log = log), ...);
+}
+
+using Sensor = LoggingModule<1>;
+using Fusion = LoggingModule<2>;
+using Planner = LoggingModule<3>;
+using Logger = LoggingModule<4>;
+using Failing = LoggingModule<5, false>;
+
+using Topology = StaticForkJoinHandler<ForkJoinStage<MainModule<Sensor>>,
+                                       ForkJoinStage<MainModule<Fusion>, WorkerModule<0, Planner>,
+                                                     WorkerModule<1, Logger>>>;
+
+}  // namespace
+
+static_assert(ForkJoinStage<MainModule<Sensor>>::kWorkerCount == 0);
+static_assert(ForkJoinStage<WorkerModule<2, Sensor>, MainModule<Fusion>>::kWorkerCount == 3);
+static_assert(Topology::kWorkerCount == 2);
+
+TEST(StaticForkJoinHandlerTest, StagesRunInOrderOnTheirExecutors) {
+  CallLog log;
+  SetLog<Sensor, Fusion, Planner, Logger>(&log);
+  Topology handler({0, 1}, 0);
+
+  for (int cycle = 0; cycle < 10; ++cycle) {
+    log.calls.clear();
+    log.threads.clear();
+    ASSERT_TRUE(handler.Execute());
+    ASSERT_EQ(log.calls.size(), 4U);
+    EXPECT_EQ(log.calls[0], 1);
+    EXPECT_EQ(log.threads[0], std::this_thread::get_id());
+    for (std::size_t call = 1; call < 4; ++call) {
+      const bool kOnMain{log.threads[call] == std::this_thread::get_id()};
+      EXPECT_EQ(kOnMain, log.calls[call] == 2) << "module " << log.calls[call];
+    }
+  }
+}
+
+TEST(StaticForkJoinHandlerTest, FailureIsReportedAndLaterStagesRun) {
+  CallLog log;
+  SetLog<Sensor, Failing>(&log);
+  StaticForkJoinHandler<ForkJoinStage<WorkerModule<0, Failing>>, ForkJoinStage<MainModule<Sensor>>> handler({0}, 0);
+
+  EXPECT_FALSE(handler.Execute());
+  EXPECT_EQ(log.calls, (std::vector<int>{5, 1}));
+}
+
+TEST(StaticForkJoinHandlerTest, LifecycleFollowsStageOrder) {
+  CallLog log;
+  SetLog<Sensor, Fusion, Planner, Logger, Failing>(&log);
+  StaticForkJoinHandler<ForkJoinStage<WorkerModule<0, Planner>, MainModule<Failing>>,
+                        ForkJoinStage<MainModule<Sensor>>>
+      handler({0}, 0);
+
+  EXPECT_TRUE(handler.Initialize());
+  EXPECT_EQ(log.calls, (std::vector<int>{3, 5, 1}));
+  EXPECT_EQ(log.threads, (std::vector<std::thread::id>(3, std::this_thread::get_id())));
+  EXPECT_FALSE(handler.Shutdown());
+}
+
+TEST(StaticForkJoinHandlerTest, MainThreadOnlyTopologyNeedsNoWorkers) {
+  CallLog log;
+  SetLog<Sensor, Fusion>(&log);
+  StaticForkJoinHandler<ForkJoinStage<MainModule<Sensor>, MainModule<Fusion>>> handler({}, 0);
+
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_EQ(log.calls, (std::vector<int>{1, 2}));
+  static_assert(std::is_same_v<decltype(handler.GetStage<0>().Get<1>()), Fusion &>);
+}
+
+TEST(StaticForkJoinHandlerTest, CoreCountMismatchShouldDie) {
+  EXPECT_EXIT({ Topology handler({0}, 0); }, ::testing::ExitedWithCode(42), "");
+}
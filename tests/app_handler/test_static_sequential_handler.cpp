@@ -0,0 +1,112 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "daal/af/app_handler/details/static_sequential_handler.hpp"
+
+using daal::af::app_base::MethodState;
+using daal::af::app_handler::StaticSequentialHandler;
+
+namespace {
+
+/** Application without a base class, records its calls into a shared log. */
+class RecordingApp {
+ public:
+  RecordingApp(std::vector<int> *log, int id, MethodState step_result = MethodState::kSuccessful)
+      : log_{log}, id_{id}, step_result_{step_result} {}
+
+  MethodState OnInitialize() { return Record(0); }
+  MethodState OnStart() { return Record(1); }
+  MethodState Step() {
+    static_cast<void>(Record(2));
+    ++steps_;
+    return step_result_;
+  }
+  MethodState OnStop() { return Record(3); }
+  MethodState OnTerminate() { return Record(4); }
+
+  int GetSteps() const noexcept { return steps_; }
+
+ private:
+  MethodState Record(int method) {
+    log_->push_back(id_ * 10 + method);
+    return MethodState::kSuccessful;
+  }
+
+  std::vector<int> *log_;
+  int id_;
+  MethodState step_result_;
+  int steps_{0};
+};
+
+class MockSafeApplication : public daal::af::app_base::SafeApplicationBase {
+ public:
+  MOCK_METHOD(MethodState, OnInitialize, (), (override));
+  MOCK_METHOD(MethodState, OnStart, (), (override));
+  MOCK_METHOD(MethodState, Step, (), (override));
+  MOCK_METHOD(MethodState, OnStop, (), (override));
+  MOCK_METHOD(MethodState, OnTerminate, (), (override));
+};
+
+}  // namespace
+
+TEST(StaticSequentialHandlerTest, CallsApplicationsInOrder) {
+  std::vector<int> log;
+  StaticSequentialHandler<RecordingApp, RecordingApp> handler{RecordingApp{&log, 1}, RecordingApp{&log, 2}};
+
+  EXPECT_TRUE(handler.Initialize());
+  EXPECT_TRUE(handler.PrepareForExecute());
+  EXPECT_TRUE(handler.Execute());
+  EXPECT_TRUE(handler.PrepareForShutdown());
+  EXPECT_TRUE(handler.Shutdown());
+  EXPECT_EQ(log, (std::vector<int>{10, 20, 11, 21, 12, 22, 13, 23, 14, 24}));
+}
+
+TEST(StaticSequentialHandlerTest, ExecuteStopsAtFirstFailure) {
+  std::vector<int> log;
+  StaticSequentialHandler<RecordingApp, RecordingApp> handler{RecordingApp{&log, 1, MethodState::kFailed},
+                                                              RecordingApp{&log, 2}};
+
+  EXPECT_FALSE(handler.Execute());
+  EXPECT_EQ(handler.Get<0>().GetSteps(), 1);
+  EXPECT_EQ(handler.Get<1>().GetSteps(), 0);
+}
+
+TEST(StaticSequentialHandlerTest, OngoingStepIsNotSuccessful) {
+  std::vector<int> log;
+  StaticSequentialHandler<RecordingApp> handler{RecordingApp{&log, 1, MethodState::kOnGoing}};
+
+  EXPECT_FALSE(handler.Execute());
+}
+
+TEST(StaticSequentialHandlerTest, SupportsSafeApplicationBase) {
+  StaticSequentialHandler<::testing::NiceMock<MockSafeApplication>> handler;
+  EXPECT_CALL(handler.Get<0>(), OnInitialize()).WillOnce(::testing::Return(MethodState::kSuccessful));
+  EXPECT_CALL(handler.Get<0>(), Step()).WillOnce(::testing::Return(MethodState::kFailed));
+
+  EXPECT_TRUE(handler.Initialize());
+  EXPECT_FALSE(handler.Execute());
+}
+
+TEST(StaticSequentialHandlerTest, SupportsOnlyNominalDegradationLevel) {
+  std::vector<int> log;
+  StaticSequentialHandler<RecordingApp> handler{RecordingApp{&log, 1}};
+  daal::af::app_handler::IApplicationHandler &iface{handler};
+
+  EXPECT_TRUE(iface.SetDegradationLevel(0));
+  EXPECT_FALSE(iface.SetDegradationLevel(1));
+}
@@ -0,0 +1,147 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "daal/af/app_handler/details/time_triggered_module_handler.hpp"
+#include "daal/af/trigger/details/daal_steady_clock.hpp"
+
+using daal::af::app_handler::IApplicationHandler;
+using daal::af::app_handler::TimeTriggeredModuleHandler;
+using daal::af::trigger::DAALSteadyClock;
+using std::chrono::milliseconds;
+
+namespace {
+
+constexpr milliseconds kHyperperiod{20};
+
+/** Module recording when and where it was executed. */
+class RecordingModule : public IApplicationHandler {
+ public:
+  explicit RecordingModule(milliseconds duration = milliseconds(0)) : duration_{duration} {}
+
+  bool Initialize() override { return true; }
+  bool PrepareForExecute() override { return true; }
+  bool Execute() override {
+    start_ = DAALSteadyClock::now();
+    thread_ = std::this_thread::get_id();
+    std::this_thread::sleep_for(duration_);
+    return true;
+  }
+  bool PrepareForShutdown() override { return true; }
+  bool Shutdown() override { return true; }
+
+  std::chrono::steady_clock::time_point start_{};
+  std::thread::id thread_{};
+
+ private:
+  milliseconds duration_;
+};
+
+/** Waits for the start of the next hyperperiod, like a PeriodicTrigger of that period would. */
+std::chrono::steady_clock::time_point WaitForHyperperiod() {
+  const auto kNow = DAALSteadyClock::now();
+  const auto kStart = kNow - (kNow.time_since_epoch() % kHyperperiod) + kHyperperiod;
+  DAALSteadyClock::sleep_until(kStart);
+  return kStart;
+}
+
+}  // namespace
+
+TEST(TimeTriggeredModuleHandlerTest, RunsSlotsAtTheirReleaseTimes) {
+  auto first = std::make_shared<RecordingModule>();
+  auto second = std::make_shared<RecordingModule>();
+  TimeTriggeredModuleHandler handler{{0},
+                                     0,
+                                     {first, second},
+                                     {kHyperperiod,
+                                      {{milliseconds(8), TimeTriggeredModuleHandler::kMainThread, 1},
+                                       {milliseconds(2), TimeTriggeredModuleHandler::kMainThread, 0}}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  const auto kStart = WaitForHyperperiod();
+  ASSERT_TRUE(handler.Execute());
+
+  EXPECT_GE(first->start_, kStart + milliseconds(2));
+  EXPECT_GE(second->start_, kStart + milliseconds(8));
+  EXPECT_LT(first->start_, second->start_);
+  EXPECT_EQ(first->thread_, std::this_thread::get_id());
+}
+
+TEST(TimeTriggeredModuleHandlerTest, CoresRunIndependently) {
+  auto main_module = std::make_shared<RecordingModule>(milliseconds(6));
+  auto worker_module = std::make_shared<RecordingModule>();
+  TimeTriggeredModuleHandler handler{{0},
+                                     0,
+                                     {main_module, worker_module},
+                                     {kHyperperiod,
+                                      {{milliseconds(1), TimeTriggeredModuleHandler::kMainThread, 0},
+                                       {milliseconds(3), 0, 1}}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  const auto kStart = WaitForHyperperiod();
+  ASSERT_TRUE(handler.Execute());
+
+  // The worker slot is released while the main thread is still busy
+  EXPECT_NE(worker_module->thread_, std::this_thread::get_id());
+  EXPECT_GE(worker_module->start_, kStart + milliseconds(3));
+  EXPECT_LT(worker_module->start_, kStart + milliseconds(7));
+  EXPECT_EQ(handler.GetLateSlotCount(), 0U);
+}
+
+TEST(TimeTriggeredModuleHandlerTest, CountsLateSlots) {
+  auto slow = std::make_shared<RecordingModule>(milliseconds(5));
+  auto next = std::make_shared<RecordingModule>();
+  TimeTriggeredModuleHandler handler{{0},
+                                     0,
+                                     {slow, next},
+                                     {kHyperperiod,
+                                      {{milliseconds(0), TimeTriggeredModuleHandler::kMainThread, 0},
+                                       {milliseconds(2), TimeTriggeredModuleHandler::kMainThread, 1}}}};
+  ASSERT_TRUE(handler.PrepareForExecute());
+
+  WaitForHyperperiod();
+  ASSERT_TRUE(handler.Execute());
+
+  EXPECT_EQ(handler.GetLateSlotCount(), 1U);
+}
+
+TEST(TimeTriggeredModuleHandlerTest, UnknownCoreTerminates) {
+  EXPECT_EXIT((TimeTriggeredModuleHandler{{0},
+                                          0,
+                                          {std::make_shared<RecordingModule>()},
+                                          {kHyperperiod, {{milliseconds(0), 7, 0}}}}),
+              ::testing::ExitedWithCode(42), "");
+}
+
+TEST(TimeTriggeredModuleHandlerTest, OffsetOutsideHyperperiodTerminates) {
+  EXPECT_EXIT((TimeTriggeredModuleHandler{{0},
+                                          0,
+                                          {std::make_shared<RecordingModule>()},
+                                          {kHyperperiod, {{kHyperperiod, 0, 0}}}}),
+              ::testing::ExitedWithCode(42), "");
+}
+
+TEST(TimeTriggeredModuleHandlerTest, UnscheduledNullModuleTerminates) {
+  EXPECT_EXIT((TimeTriggeredModuleHandler{{0},
+                                          0,
+                                          {std::make_shared<RecordingModule>(), nullptr},
+                                          {kHyperperiod, {{milliseconds(0), 0, 0}}}}),
+              ::testing::ExitedWithCode(42), "");
+}
@@ -14,8 +14,19 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
 #include "daal/af/checkpoint/details/checkpoint_container.hpp"
 #include "daal/af/checkpoint/icheckpoint.hpp"
+#include "daal/af/runtime_statistics/reporting_backend.hpp"
+#include "daal/af/runtime_statistics/runtime_statistics.hpp"
+#include "daal/af/runtime_statistics/time_provider.hpp"
 
 using namespace daal::af::checkpoint;
 
@@ -40,6 +51,7 @@ TEST_F(CheckpointContainerTest, AddCheckpoint_Before) {
   auto checkpoint = std::make_shared<MockCheckpoint>();
   const std::string checkpoint1 = "checkpoint1";
   EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::BEFORE));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(checkpoint1));
 
   auto result = container.AddCheckpoint(checkpoint);
   EXPECT_EQ(result, std::error_code{});
@@ -49,6 +61,7 @@ TEST_F(CheckpointContainerTest, AddCheckpoint_After) {
   auto checkpoint = std::make_shared<MockCheckpoint>();
   const std::string checkpoint2 = "checkpoint2";
   EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::AFTER));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(checkpoint2));
 
   auto result = container.AddCheckpoint(checkpoint);
   EXPECT_EQ(result, std::error_code{});
@@ -127,7 +140,9 @@ TEST_F(CheckpointContainerTest, AddCheckpoint_DuplicateAfter) {
 
 TEST_F(CheckpointContainerTest, TriggerCheckpoints_Before) {
   auto checkpoint = std::make_shared<MockCheckpoint>();
+  const std::string name = "checkpoint";
   EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::BEFORE));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(name));
   EXPECT_CALL(*checkpoint, Trigger())
       .WillOnce(testing::Return(std::error_code{}));
 
@@ -138,7 +153,9 @@ TEST_F(CheckpointContainerTest, TriggerCheckpoints_Before) {
 
 TEST_F(CheckpointContainerTest, TriggerCheckpoints_After) {
   auto checkpoint = std::make_shared<MockCheckpoint>();
+  const std::string name = "checkpoint";
   EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::AFTER));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(name));
   EXPECT_CALL(*checkpoint, Trigger())
       .WillOnce(testing::Return(std::error_code{}));
 
@@ -149,7 +166,9 @@ TEST_F(CheckpointContainerTest, TriggerCheckpoints_After) {
 
 TEST_F(CheckpointContainerTest, TriggerCheckpoints_Error) {
   auto checkpoint = std::make_shared<MockCheckpoint>();
+  const std::string name = "checkpoint";
   EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::BEFORE));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(name));
   EXPECT_CALL(*checkpoint, Trigger())
       .WillOnce(testing::Return(
           std::make_error_code(std::errc::operation_not_permitted)));
@@ -157,4 +176,257 @@ TEST_F(CheckpointContainerTest, TriggerCheckpoints_Error) {
   container.AddCheckpoint(checkpoint);
   auto result = container.TriggerCheckpoints(When::BEFORE);
   EXPECT_EQ(result, std::make_error_code(std::errc::operation_not_permitted));
-}
\ No newline at end of file
+}
+
+TEST_F(CheckpointContainerTest, AddCheckpoint_SameNameInBothEvents) {
+  auto before = std::make_shared<MockCheckpoint>();
+  auto after = std::make_shared<MockCheckpoint>();
+  const std::string name = "alive";
+  EXPECT_CALL(*before, GetWhen()).WillOnce(testing::Return(When::BEFORE));
+  EXPECT_CALL(*before, GetName()).WillOnce(testing::ReturnRef(name));
+  EXPECT_CALL(*after, GetWhen()).WillOnce(testing::Return(When::AFTER));
+  EXPECT_CALL(*after, GetName()).WillOnce(testing::ReturnRef(name));
+
+  EXPECT_EQ(container.AddCheckpoint(before), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(after), std::error_code{});
+}
+
+namespace {
+
+/** A checkpoint of a final type, triggered without virtual dispatch. */
+class CountingCheckpoint final : public ICheckpoint {
+ public:
+  CountingCheckpoint(std::string name, When when, std::error_code result)
+      : name_{std::move(name)}, when_{when}, result_{result} {}
+  std::error_code Trigger() override {
+    ++count_;
+    return result_;
+  }
+  When GetWhen() const override { return when_; }
+  std::string const& GetName() const override { return name_; }
+  int GetCount() const { return count_; }
+
+ private:
+  std::string name_;
+  When when_;
+  std::error_code result_;
+  int count_{0};
+};
+
+}  // namespace
+
+TEST_F(CheckpointContainerTest, Freeze_KeepsOrderAndResults) {
+  auto before1 = std::make_shared<CountingCheckpoint>("before1", When::BEFORE, std::error_code{});
+  auto after = std::make_shared<CountingCheckpoint>("after", When::AFTER,
+                                                    std::make_error_code(std::errc::timed_out));
+  auto before2 = std::make_shared<CountingCheckpoint>("before2", When::BEFORE, std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(before1), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(after), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(before2), std::error_code{});
+  EXPECT_FALSE(container.IsFrozen());
+
+  container.Freeze();
+  container.Freeze();
+  EXPECT_TRUE(container.IsFrozen());
+
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  EXPECT_EQ(before1->GetCount(), 1);
+  EXPECT_EQ(before2->GetCount(), 1);
+  EXPECT_EQ(after->GetCount(), 0);
+  EXPECT_EQ(container.TriggerCheckpoints(When::AFTER), std::make_error_code(std::errc::timed_out));
+  EXPECT_EQ(after->GetCount(), 1);
+  EXPECT_EQ(before1->GetCount(), 1);
+}
+
+TEST_F(CheckpointContainerTest, Freeze_RejectsFurtherCheckpoints) {
+  container.Freeze();
+  auto checkpoint = std::make_shared<CountingCheckpoint>("late", When::BEFORE, std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(checkpoint), std::make_error_code(std::errc::operation_not_permitted));
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  EXPECT_EQ(container.TriggerCheckpoints(When::AFTER), std::error_code{});
+  EXPECT_EQ(checkpoint->GetCount(), 0);
+}
+
+namespace {
+
+/** Manually advanced clock, CPU time equals real time. */
+class ScriptedTimeProvider : public daal::af::runtime_statistics::TimeProvider {
+ public:
+  std::uint64_t GetRealTime() noexcept override { return real_; }
+  std::uint64_t GetCPUTime() noexcept override { return real_; }
+
+  void Advance(std::uint64_t delta) noexcept { real_ += delta; }
+
+ private:
+  std::uint64_t real_{1000};
+};
+
+class NullBackend : public daal::af::runtime_statistics::IReportingBackend {
+ public:
+  void Show(const daal::af::runtime_statistics::RuntimeStatistics::Statistics&) noexcept override {}
+};
+
+/** A checkpoint taking a fixed time of the scripted clock. */
+class TimedCheckpoint final : public ICheckpoint {
+ public:
+  TimedCheckpoint(std::string name, When when, std::shared_ptr<ScriptedTimeProvider> time, std::uint64_t duration,
+                  std::chrono::microseconds budget)
+      : name_{std::move(name)}, when_{when}, time_{std::move(time)}, duration_{duration}, budget_{budget} {}
+  std::error_code Trigger() override {
+    time_->Advance(duration_);
+    return {};
+  }
+  When GetWhen() const override { return when_; }
+  std::string const& GetName() const override { return name_; }
+  std::chrono::microseconds GetTimeBudget() const override { return budget_; }
+
+ private:
+  std::string name_;
+  When when_;
+  std::shared_ptr<ScriptedTimeProvider> time_;
+  std::uint64_t duration_;
+  std::chrono::microseconds budget_;
+};
+
+}  // namespace
+
+TEST_F(CheckpointContainerTest, Statistics_DisabledByDefault) {
+  EXPECT_FALSE(container.GetStatistics(When::BEFORE).IsEnabled());
+  EXPECT_FALSE(container.GetStatistics(When::AFTER).IsEnabled());
+}
+
+TEST_F(CheckpointContainerTest, Statistics_MeasuresEveryCheckpointAndCountsOverruns) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  auto fast = std::make_shared<TimedCheckpoint>("fast", When::BEFORE, time, 10, std::chrono::microseconds{0});
+  auto slow = std::make_shared<TimedCheckpoint>("slow", When::BEFORE, time, 200, std::chrono::microseconds{100});
+  auto after = std::make_shared<TimedCheckpoint>("fast", When::AFTER, time, 30, std::chrono::microseconds{50});
+  ASSERT_EQ(container.AddCheckpoint(fast), std::error_code{});
+  ASSERT_EQ(container.AddCheckpoint(slow), std::error_code{});
+  ASSERT_EQ(container.AddCheckpoint(after), std::error_code{});
+  container.Freeze();
+  container.EnableStatistics("test", time, std::make_shared<NullBackend>());
+
+  // the first cycle has no delta time yet, the second one passes the startup wait time
+  for (int cycle = 0; cycle < 4; ++cycle) {
+    EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+    EXPECT_EQ(container.TriggerCheckpoints(When::AFTER), std::error_code{});
+    time->Advance(2 * daal::af::runtime_statistics::TimeProvider::kMicrosecondsPerSecond);
+  }
+
+  auto& before_statistics = container.GetStatistics(When::BEFORE);
+  ASSERT_EQ(before_statistics.Size(), 2U);
+  const auto& kFast = before_statistics.Get(0)->Get();
+  EXPECT_EQ(kFast.name, "test.before.fast");
+  EXPECT_EQ(kFast.cycle_count, 3U);
+  EXPECT_EQ(kFast.overrun_count, 0U);
+  EXPECT_FLOAT_EQ(kFast.gross_execution_time.maximum, 10.0F);
+  const auto& kSlow = before_statistics.Get(1)->Get();
+  EXPECT_EQ(kSlow.name, "test.before.slow");
+  EXPECT_EQ(kSlow.overrun_count, 3U);
+  EXPECT_FLOAT_EQ(kSlow.gross_execution_time.maximum, 200.0F);
+
+  auto& after_statistics = container.GetStatistics(When::AFTER);
+  ASSERT_EQ(after_statistics.Size(), 1U);
+  const auto& kAfter = after_statistics.Get(0)->Get();
+  EXPECT_EQ(kAfter.name, "test.after.fast");
+  EXPECT_EQ(kAfter.overrun_count, 0U);
+  EXPECT_FLOAT_EQ(kAfter.gross_execution_time.maximum, 30.0F);
+}
+
+TEST_F(CheckpointContainerTest, Statistics_LateCheckpointIsNotMeasured) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  auto early = std::make_shared<TimedCheckpoint>("early", When::BEFORE, time, 10, std::chrono::microseconds{0});
+  auto late = std::make_shared<TimedCheckpoint>("late", When::BEFORE, time, 10, std::chrono::microseconds{0});
+  ASSERT_EQ(container.AddCheckpoint(early), std::error_code{});
+  container.EnableStatistics("test", time, std::make_shared<NullBackend>());
+  ASSERT_EQ(container.AddCheckpoint(late), std::error_code{});
+
+  const std::uint64_t kStart{time->GetRealTime()};
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  EXPECT_EQ(time->GetRealTime() - kStart, 20U);
+  EXPECT_EQ(container.GetStatistics(When::BEFORE).Size(), 1U);
+}
+
+namespace {
+
+/** Polls the predicate until it holds or a generous timeout expired. */
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+  const auto kDeadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+  bool satisfied{predicate()};
+  while (!satisfied && std::chrono::steady_clock::now() < kDeadline) {
+    std::this_thread::sleep_for(std::chrono::microseconds{100});
+    satisfied = predicate();
+  }
+  return satisfied;
+}
+
+}  // namespace
+
+TEST_F(CheckpointContainerTest, AddCheckpoint_DuplicateAsync) {
+  auto checkpoint = std::make_shared<MockCheckpoint>();
+  const std::string name = "async";
+  EXPECT_CALL(*checkpoint, GetWhen()).WillRepeatedly(testing::Return(When::ASYNC));
+  EXPECT_CALL(*checkpoint, GetName()).WillRepeatedly(testing::ReturnRef(name));
+
+  EXPECT_EQ(container.AddCheckpoint(checkpoint), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(checkpoint), std::make_error_code(std::errc::invalid_argument));
+}
+
+TEST_F(CheckpointContainerTest, TriggerCheckpoints_AsyncWithoutCheckpoints) {
+  EXPECT_EQ(container.TriggerCheckpoints(When::ASYNC), std::error_code{});
+}
+
+TEST_F(CheckpointContainerTest, TriggerCheckpoints_AsyncDoesNotBlockAndReportsErrorNextCycle) {
+  auto checkpoint = std::make_shared<MockCheckpoint>();
+  std::atomic<bool> release{false};
+  std::atomic<int> triggered{0};
+  const std::string name = "async";
+  EXPECT_CALL(*checkpoint, GetWhen()).WillOnce(testing::Return(When::ASYNC));
+  EXPECT_CALL(*checkpoint, GetName()).WillOnce(testing::ReturnRef(name));
+  EXPECT_CALL(*checkpoint, Trigger()).WillRepeatedly([&release, &triggered]() {
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+    ++triggered;
+    return std::make_error_code(std::errc::timed_out);
+  });
+  container.AddCheckpoint(checkpoint);
+
+  // the checkpoint blocks, triggering returns nevertheless
+  EXPECT_EQ(container.TriggerCheckpoints(When::ASYNC), std::error_code{});
+  // the previous round is still running, this round is skipped
+  EXPECT_EQ(container.TriggerCheckpoints(When::ASYNC), std::error_code{});
+  EXPECT_EQ(triggered.load(), 0);
+  EXPECT_EQ(container.GetSkippedAsyncRounds(), 1U);
+
+  release = true;
+  ASSERT_TRUE(WaitFor([&triggered]() { return triggered.load() == 1; }));
+  // the error of the first round is reported one cycle later
+  EXPECT_TRUE(WaitFor([this]() {
+    return container.TriggerCheckpoints(When::ASYNC) == std::make_error_code(std::errc::timed_out);
+  }));
+}
+
+TEST(AsyncCheckpointGroupTest, CountsSkippedRounds) {
+  AsyncCheckpointGroup group{0, 0};
+  auto checkpoint = std::make_shared<MockCheckpoint>();
+  std::atomic<bool> release{false};
+  EXPECT_CALL(*checkpoint, Trigger()).WillRepeatedly([&release]() {
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+    return std::error_code{};
+  });
+  group.Add(checkpoint);
+
+  EXPECT_EQ(group.Trigger(), std::error_code{});
+  EXPECT_TRUE(group.IsBusy());
+  EXPECT_EQ(group.Trigger(), std::error_code{});
+  EXPECT_EQ(group.Trigger(), std::error_code{});
+  EXPECT_EQ(group.GetSkippedRounds(), 2U);
+
+  release = true;
+  EXPECT_TRUE(WaitFor([&group]() { return !group.IsBusy(); }));
+  EXPECT_EQ(group.Trigger(), std::error_code{});
+}
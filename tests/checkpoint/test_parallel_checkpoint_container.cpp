@@ -0,0 +1,201 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "daal/af/checkpoint/details/parallel_checkpoint_container.hpp"
+
+using namespace daal::af::checkpoint;
+
+namespace {
+
+class FunctionCheckpoint : public ICheckpoint {
+ public:
+  FunctionCheckpoint(std::string name, When when, std::function<std::error_code()> function)
+      : name_{std::move(name)}, when_{when}, function_{std::move(function)} {}
+
+  std::error_code Trigger() override { return function_(); }
+  When GetWhen() const override { return when_; }
+  std::string const &GetName() const override { return name_; }
+
+ private:
+  std::string name_;
+  When when_;
+  std::function<std::error_code()> function_;
+};
+
+std::shared_ptr<ICheckpoint> MakeCheckpoint(const std::string &name, When when = When::BEFORE,
+                                            std::function<std::error_code()> function = []() {
+                                              return std::error_code{};
+                                            }) {
+  return std::make_shared<FunctionCheckpoint>(name, when, std::move(function));
+}
+
+}  // namespace
+
+class ParallelCheckpointContainerTest : public ::testing::Test {
+ protected:
+  ParallelCheckpointContainer container{{0}, 0};
+};
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_Invalid) {
+  EXPECT_EQ(container.AddCheckpoint(nullptr), std::make_error_code(std::errc::invalid_argument));
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("invalid", static_cast<When>(-1))),
+            std::make_error_code(std::errc::invalid_argument));
+}
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_Duplicate) {
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("checkpoint")), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("checkpoint")), std::make_error_code(std::errc::invalid_argument));
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("checkpoint", When::AFTER)), std::error_code{});
+}
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_UnknownDependency) {
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("first")), std::error_code{});
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("second"), {"first", "missing"}),
+            std::make_error_code(std::errc::invalid_argument));
+  // dependencies do not cross categories
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("after", When::AFTER), {"first"}),
+            std::make_error_code(std::errc::invalid_argument));
+}
+
+TEST_F(ParallelCheckpointContainerTest, TriggerCheckpoints_Empty) {
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  EXPECT_EQ(container.TriggerCheckpoints(When::AFTER), std::error_code{});
+  EXPECT_EQ(container.TriggerCheckpoints(When::ASYNC), std::error_code{});
+}
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_AsyncIsRejected) {
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("async", When::ASYNC)),
+            std::make_error_code(std::errc::invalid_argument));
+}
+
+TEST_F(ParallelCheckpointContainerTest, TriggerCheckpoints_TriggersCategoryOnly) {
+  std::atomic<int> before{0};
+  std::atomic<int> after{0};
+  for (int idx = 0; idx < 8; ++idx) {
+    container.AddCheckpoint(MakeCheckpoint("before" + std::to_string(idx), When::BEFORE, [&before]() {
+      ++before;
+      return std::error_code{};
+    }));
+  }
+  container.AddCheckpoint(MakeCheckpoint("after", When::AFTER, [&after]() {
+    ++after;
+    return std::error_code{};
+  }));
+
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  }
+  EXPECT_EQ(before.load(), 24);
+  EXPECT_EQ(after.load(), 0);
+}
+
+TEST_F(ParallelCheckpointContainerTest, TriggerCheckpoints_RespectsDependencies) {
+  std::mutex mutex;
+  std::vector<std::string> order;
+  auto record = [&mutex, &order](const std::string &name, std::chrono::milliseconds delay) {
+    return [&mutex, &order, name, delay]() {
+      std::this_thread::sleep_for(delay);
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(name);
+      return std::error_code{};
+    };
+  };
+  container.AddCheckpoint(MakeCheckpoint("phm", When::BEFORE, record("phm", std::chrono::milliseconds{20})));
+  container.AddCheckpoint(MakeCheckpoint("trace", When::BEFORE, record("trace", std::chrono::milliseconds{0})));
+  container.AddCheckpoint(MakeCheckpoint("monitor", When::BEFORE, record("monitor", std::chrono::milliseconds{0})),
+                          {"phm"});
+
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  ASSERT_EQ(order.size(), 3U);
+  EXPECT_EQ(order[2], "monitor");
+}
+
+TEST_F(ParallelCheckpointContainerTest, TriggerCheckpoints_RunsIndependentConcurrently) {
+  std::atomic<int> arrived{0};
+  auto rendezvous = [&arrived]() {
+    ++arrived;
+    const auto kDeadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (arrived.load() < 2 && std::chrono::steady_clock::now() < kDeadline) {
+      std::this_thread::yield();
+    }
+    return arrived.load() >= 2 ? std::error_code{} : std::make_error_code(std::errc::timed_out);
+  };
+  container.AddCheckpoint(MakeCheckpoint("first", When::AFTER, rendezvous));
+  container.AddCheckpoint(MakeCheckpoint("second", When::AFTER, rendezvous));
+
+  EXPECT_EQ(container.TriggerCheckpoints(When::AFTER), std::error_code{});
+}
+
+TEST_F(ParallelCheckpointContainerTest, TriggerCheckpoints_ReturnsErrorOfLastFailedCheckpoint) {
+  std::atomic<int> triggered{0};
+  container.AddCheckpoint(MakeCheckpoint("first", When::BEFORE, [&triggered]() {
+    ++triggered;
+    return std::make_error_code(std::errc::io_error);
+  }));
+  container.AddCheckpoint(MakeCheckpoint("second", When::BEFORE, [&triggered]() {
+    ++triggered;
+    return std::make_error_code(std::errc::timed_out);
+  }));
+  container.AddCheckpoint(MakeCheckpoint("third", When::BEFORE, [&triggered]() {
+    ++triggered;
+    return std::error_code{};
+  }), {"first"});
+
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::make_error_code(std::errc::timed_out));
+  EXPECT_EQ(triggered.load(), 3);
+}
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_AfterTriggerIsRejected) {
+  container.AddCheckpoint(MakeCheckpoint("first"));
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("second")),
+            std::make_error_code(std::errc::operation_not_permitted));
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("after", When::AFTER)), std::error_code{});
+}
+
+TEST_F(ParallelCheckpointContainerTest, AddCheckpoint_AfterFreezeIsRejected) {
+  container.AddCheckpoint(MakeCheckpoint("first"));
+  container.Freeze();
+
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("second")),
+            std::make_error_code(std::errc::operation_not_permitted));
+  EXPECT_EQ(container.AddCheckpoint(MakeCheckpoint("after", When::AFTER)),
+            std::make_error_code(std::errc::operation_not_permitted));
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+}
+
+TEST(ParallelCheckpointContainerNoWorkerTest, TriggersOnCallingThread) {
+  ParallelCheckpointContainer container{{}, 0};
+  std::thread::id thread;
+  container.AddCheckpoint(MakeCheckpoint("first", When::BEFORE, [&thread]() {
+    thread = std::this_thread::get_id();
+    return std::error_code{};
+  }));
+
+  EXPECT_EQ(container.TriggerCheckpoints(When::BEFORE), std::error_code{});
+  EXPECT_EQ(thread, std::this_thread::get_id());
+}
@@ -0,0 +1,107 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "daal/af/exe/details/degradation_policy.hpp"
+
+using daal::af::exe::DegradationPolicy;
+using daal::af::exe::DegradationStep;
+
+namespace {
+
+constexpr std::chrono::microseconds kBudget{1000};
+
+DegradationPolicy MakePolicy() {
+  // stretch the period first, then skip the optional modules
+  return DegradationPolicy{kBudget, {{1.5F, 0U}, {1.5F, 1U}}, 2U, 3U, 0.5F};
+}
+
+}  // namespace
+
+TEST(DegradationPolicyTest, StartsNominal) {
+  const auto policy = MakePolicy();
+  EXPECT_EQ(policy.GetLevel(), 0U);
+  EXPECT_EQ(policy.GetMaxLevel(), 2U);
+  EXPECT_FLOAT_EQ(policy.GetStep().period_scale, 1.0F);
+  EXPECT_EQ(policy.GetStep().shed_level, 0U);
+}
+
+TEST(DegradationPolicyTest, DegradesAfterConsecutiveOverruns) {
+  auto policy = MakePolicy();
+  EXPECT_FALSE(policy.Update(1500));
+  EXPECT_TRUE(policy.Update(1500));
+  EXPECT_EQ(policy.GetLevel(), 1U);
+  EXPECT_FLOAT_EQ(policy.GetStep().period_scale, 1.5F);
+
+  EXPECT_FALSE(policy.Update(1500));
+  EXPECT_TRUE(policy.Update(1500));
+  EXPECT_EQ(policy.GetLevel(), 2U);
+  EXPECT_EQ(policy.GetStep().shed_level, 1U);
+
+  // the highest level is kept
+  EXPECT_FALSE(policy.Update(1500));
+  EXPECT_FALSE(policy.Update(1500));
+  EXPECT_EQ(policy.GetLevel(), 2U);
+}
+
+TEST(DegradationPolicyTest, MissedActivationsCountAsOverruns) {
+  auto policy = MakePolicy();
+  EXPECT_FALSE(policy.Update(400, 1U));
+  EXPECT_TRUE(policy.Update(400, 2U));
+  EXPECT_EQ(policy.GetLevel(), 1U);
+
+  // cycles without missed activations recover as usual
+  EXPECT_FALSE(policy.Update(400));
+  EXPECT_FALSE(policy.Update(400));
+  EXPECT_TRUE(policy.Update(400));
+  EXPECT_EQ(policy.GetLevel(), 0U);
+}
+
+TEST(DegradationPolicyTest, SingleOverrunsDoNotDegrade) {
+  auto policy = MakePolicy();
+  for (int cycle = 0; cycle < 10; ++cycle) {
+    EXPECT_FALSE(policy.Update(1500));
+    EXPECT_FALSE(policy.Update(800));
+  }
+  EXPECT_EQ(policy.GetLevel(), 0U);
+}
+
+TEST(DegradationPolicyTest, RecoversBelowThresholdOnly) {
+  auto policy = MakePolicy();
+  policy.Update(1500);
+  policy.Update(1500);
+  ASSERT_EQ(policy.GetLevel(), 1U);
+
+  // within the budget but above the recovery threshold
+  for (int cycle = 0; cycle < 10; ++cycle) {
+    EXPECT_FALSE(policy.Update(800));
+  }
+  EXPECT_EQ(policy.GetLevel(), 1U);
+
+  EXPECT_FALSE(policy.Update(400));
+  EXPECT_FALSE(policy.Update(400));
+  EXPECT_TRUE(policy.Update(400));
+  EXPECT_EQ(policy.GetLevel(), 0U);
+  EXPECT_FALSE(policy.Update(400));
+}
+
+TEST(DegradationPolicyTest, InvalidArgumentsShouldDie) {
+  EXPECT_EXIT({ DegradationPolicy policy(std::chrono::microseconds{0}, {}); }, ::testing::ExitedWithCode(42), "");
+  EXPECT_EXIT({ DegradationPolicy policy(kBudget, {{0.5F, 0U}}); }, ::testing::ExitedWithCode(42), "");
+  EXPECT_EXIT({ DegradationPolicy policy(kBudget, {}, 0U); }, ::testing::ExitedWithCode(42), "");
+  EXPECT_EXIT({ DegradationPolicy policy(kBudget, {}, 1U, 1U, 1.5F); }, ::testing::ExitedWithCode(42), "");
+}
@@ -0,0 +1,108 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "daal/af/app_handler/details/fork_join_module_handler.hpp"
+#include "daal/af/checkpoint/details/checkpoint_container.hpp"
+#include "daal/af/env/execution_environment.hpp"
+#include "daal/af/exe/details/degradation_policy.hpp"
+#include "daal/af/exe/details/executor_impl.hpp"
+#include "daal/af/os/posix_helper.hpp"
+#include "daal/af/trigger/trigger.hpp"
+
+using daal::af::app_handler::ForkJoinModuleHandler;
+using daal::af::exe::DegradationPolicy;
+using daal::af::exe::Executor;
+
+namespace {
+
+constexpr std::chrono::microseconds kBudget{1000};
+
+/** Environment requesting termination after a number of cycles. */
+class CycleLimitedEnvironment : public daal::af::env::ExecutionEnvironment {
+ public:
+  explicit CycleLimitedEnvironment(std::uint32_t cycles) : remaining_cycles_{cycles} {}
+
+  bool Init() override { return true; }
+  bool Deinit() override { return true; }
+  void SetState(const State /*state*/) noexcept override {}
+  bool IsSigTerm() const noexcept override { return remaining_cycles_-- == 0U; }
+  bool Refresh() const noexcept override { return true; }
+
+ private:
+  mutable std::uint32_t remaining_cycles_;
+};
+
+class PermissivePosixHelper : public daal::af::os::IPosixHelper {
+ public:
+  bool IsNoEnvVarSet(char const * /*search_str*/, char const * /*ignore_str*/) override { return true; }
+  bool IsFpuWorking(float /*f_precision*/) override { return true; }
+  bool DropPrivileges() override { return true; }
+  void SetupOomHandler() override {}
+};
+
+/** Trigger activating the cycles back to back. */
+class ImmediateTrigger : public daal::af::trigger::Trigger {
+ public:
+  bool CheckTriggerConditionAndWait() override { return true; }
+};
+
+/** Module sleeping longer than the budget, the executor thread meanwhile waits in the join. */
+class SlowModule : public daal::af::app_handler::IApplicationHandler {
+ public:
+  bool Initialize() override { return true; }
+  bool PrepareForExecute() override { return true; }
+  bool Execute() override {
+    ++executions;
+    std::this_thread::sleep_for(3 * kBudget);
+    return true;
+  }
+  bool PrepareForShutdown() override { return true; }
+  bool Shutdown() override { return true; }
+
+  std::atomic<std::uint32_t> executions{0};
+};
+
+}  // namespace
+
+TEST(ExecutorDegradationTest, OverrunOfWorkerModuleRaisesShedLevel) {
+  constexpr std::uint32_t kCycles{8};
+  auto slow_module = std::make_shared<SlowModule>();
+  auto handler = std::make_unique<ForkJoinModuleHandler>(
+      std::vector<unsigned int>{0}, 0,
+      ForkJoinModuleHandler::ModuleGraph{
+          {ForkJoinModuleHandler::TaskAffinity::WORKER, slow_module, 0, {}, 1U}});
+  const ForkJoinModuleHandler &kHandler{*handler};
+
+  Executor executor{std::make_unique<CycleLimitedEnvironment>(kCycles), std::make_unique<PermissivePosixHelper>(),
+                    std::make_unique<ImmediateTrigger>(),
+                    std::make_unique<daal::af::checkpoint::CheckpointContainer>()};
+  executor.SetApplicationHandler(std::move(handler));
+  executor.SetDegradationPolicy(
+      std::make_unique<DegradationPolicy>(kBudget, std::vector<daal::af::exe::DegradationStep>{{1.0F, 1U}}, 2U));
+
+  // the executor thread only waits for the worker, its core execution time stays far below the budget
+  ASSERT_TRUE(executor.Run());
+
+  EXPECT_EQ(kHandler.GetDegradationLevel(), 1U);
+  EXPECT_LT(slow_module->executions.load(), kCycles);
+}
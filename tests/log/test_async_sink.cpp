@@ -0,0 +1,171 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "daal/log/details/async_sink.hpp"
+#include "daal/log/logger.hpp"
+
+using daal::log::AsyncSink;
+using daal::log::LogLevel;
+using daal::log::MessageBuffer;
+
+namespace {
+
+/** Records the shown messages, optionally blocking until released to simulate a stalled output. */
+class RecordingSink : public daal::log::Sink {
+ public:
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) override {
+    std::unique_lock<std::mutex> lock{mutex_};
+    released_.wait(lock, [this] { return !is_blocked_; });
+    messages_.emplace_back(buffer.data());
+    levels_.push_back(log_level);
+  }
+
+  void Flush() override {
+    std::lock_guard<std::mutex> lock{mutex_};
+    ++flush_count_;
+  }
+
+  void Block() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    is_blocked_ = true;
+  }
+
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      is_blocked_ = false;
+    }
+    released_.notify_all();
+  }
+
+  std::vector<std::string> Messages() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return messages_;
+  }
+
+  std::vector<LogLevel> Levels() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return levels_;
+  }
+
+  int FlushCount() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return flush_count_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable released_;
+  bool is_blocked_{false};
+  std::vector<std::string> messages_;
+  std::vector<LogLevel> levels_;
+  int flush_count_{0};
+};
+
+MessageBuffer MakeMessage(const std::string &text) {
+  MessageBuffer buffer{};
+  std::strncpy(buffer.data(), text.c_str(), buffer.size() - 1);
+  return buffer;
+}
+
+}  // namespace
+
+TEST(AsyncSinkTest, ShowsMessagesInOrder) {
+  auto recording = std::make_shared<RecordingSink>();
+  {
+    AsyncSink sink{recording};
+    for (int idx = 0; idx < 100; ++idx) {
+      sink.ShowBuffer(LogLevel::kInfo, MakeMessage("message " + std::to_string(idx)));
+    }
+    sink.Flush();
+    EXPECT_EQ(recording->Messages().size(), 100U);
+    EXPECT_EQ(sink.GetDroppedCount(), 0U);
+  }
+  const auto kMessages = recording->Messages();
+  ASSERT_EQ(kMessages.size(), 100U);
+  for (int idx = 0; idx < 100; ++idx) {
+    EXPECT_EQ(kMessages[idx], "message " + std::to_string(idx));
+  }
+  EXPECT_GE(recording->FlushCount(), 1);
+}
+
+TEST(AsyncSinkTest, StalledOutputDoesNotBlockAndDropsAreCounted) {
+  auto recording = std::make_shared<RecordingSink>();
+  recording->Block();
+  AsyncSink sink{recording, 8};
+
+  const auto kStart = std::chrono::steady_clock::now();
+  for (int idx = 0; idx < 100; ++idx) {
+    sink.ShowBuffer(LogLevel::kError, MakeMessage("message"));
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - kStart, std::chrono::seconds(1));
+
+  // At most the queue and the message blocked in the output are kept
+  EXPECT_GE(sink.GetDroppedCount(), 100U - 9U);
+
+  recording->Release();
+  sink.Flush();
+  const auto kMessages = recording->Messages();
+  const auto kLevels = recording->Levels();
+  ASSERT_FALSE(kMessages.empty());
+  EXPECT_EQ(kMessages.size() - 1 + sink.GetDroppedCount(), 100U);
+  EXPECT_EQ(kMessages.back(), std::to_string(sink.GetDroppedCount()) + " log messages dropped");
+  EXPECT_EQ(kLevels.back(), LogLevel::kWarning);
+}
+
+TEST(AsyncSinkTest, ConcurrentProducers) {
+  auto recording = std::make_shared<RecordingSink>();
+  AsyncSink sink{recording, 4096};
+  std::vector<std::thread> producers;
+  for (int thread = 0; thread < 4; ++thread) {
+    producers.emplace_back([&sink, thread] {
+      for (int idx = 0; idx < 500; ++idx) {
+        sink.ShowBuffer(LogLevel::kInfo, MakeMessage(std::to_string(thread)));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  sink.Flush();
+  EXPECT_EQ(recording->Messages().size() + sink.GetDroppedCount(), 2000U);
+  EXPECT_EQ(sink.GetDroppedCount(), 0U);
+}
+
+TEST(AsyncSinkTest, RespectsLogLevelAndForwardsContext) {
+  auto recording = std::make_shared<RecordingSink>();
+  auto sink = std::make_shared<AsyncSink>(recording);
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  ASSERT_TRUE(logger->AddSink(sink));
+  sink->SetLogLevel(LogLevel::kWarning);
+
+  logger->Info("not shown");
+  logger->Error("shown {}", 42);
+  sink->Flush();
+
+  EXPECT_EQ(recording->GetContext(), "TEST_");
+  const auto kMessages = recording->Messages();
+  ASSERT_EQ(kMessages.size(), 1U);
+  EXPECT_EQ(kMessages.front(), "shown 42");
+}
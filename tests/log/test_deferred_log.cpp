@@ -0,0 +1,246 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "daal/log/deferred_message.hpp"
+#include "daal/log/details/async_sink.hpp"
+#include "daal/log/details/binary_file_sink.hpp"
+#include "daal/log/format_registry.hpp"
+#include "daal/log/logger.hpp"
+#include "daal/log/sink.hpp"
+
+using daal::log::DeferredMessage;
+using daal::log::FormatRegistry;
+using daal::log::LogLevel;
+using daal::log::MessageBuffer;
+
+namespace {
+
+/** Records the messages it gets, deferred or not. Called from one thread only. */
+class RecordingSink : public daal::log::Sink {
+ public:
+  explicit RecordingSink(bool is_deferred) : is_deferred_{is_deferred} {}
+
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) override {
+    if (WouldShow(log_level)) {
+      formatted_.emplace_back(buffer.data());
+    }
+  }
+
+  void ShowDeferred(LogLevel log_level, const DeferredMessage &message) override {
+    if (WouldShow(log_level)) {
+      MessageBuffer buffer{};
+      daal::log::FormatDeferred(message, buffer);
+      deferred_.emplace_back(buffer.data());
+    }
+  }
+
+  bool IsDeferred() const override { return is_deferred_; }
+
+  void Flush() override {}
+
+  const std::vector<std::string> &Formatted() const { return formatted_; }
+  const std::vector<std::string> &Deferred() const { return deferred_; }
+
+ private:
+  bool is_deferred_;
+  std::vector<std::string> formatted_;
+  std::vector<std::string> deferred_;
+};
+
+template <typename... T>
+std::string Roundtrip(fmt::string_view format, const T &...args) {
+  DeferredMessage message{};
+  EXPECT_TRUE(daal::log::EncodeDeferred(message, format, args...));
+  MessageBuffer buffer{};
+  EXPECT_TRUE(daal::log::FormatDeferred(message, buffer));
+  return buffer.data();
+}
+
+/** Decodes a binary log file into the types of its records and its messages. */
+void ReadLogFile(const std::string &path, std::vector<daal::log::LogRecordType> &types,
+                 std::vector<std::string> &messages) {
+  std::FILE *file{std::fopen(path.c_str(), "rb")};
+  ASSERT_NE(file, nullptr);
+  std::array<char, 8> magic{};
+  ASSERT_EQ(std::fread(magic.data(), magic.size(), 1, file), 1U);
+  EXPECT_EQ(magic, daal::log::kLogFileMagic);
+
+  std::map<std::uint16_t, std::string> formats;
+  daal::log::LogRecordHeader header{};
+  while (std::fread(&header, sizeof(header), 1, file) == 1) {
+    std::vector<std::uint8_t> payload(header.size);
+    ASSERT_TRUE(payload.empty() || std::fread(payload.data(), payload.size(), 1, file) == 1);
+    types.push_back(header.type);
+    if (header.type == daal::log::LogRecordType::kFormat) {
+      formats[header.format_id].assign(payload.begin(), payload.end());
+    } else if (header.type == daal::log::LogRecordType::kMessage) {
+      ASSERT_EQ(formats.count(header.format_id), 1U) << "message before its format";
+      MessageBuffer buffer{};
+      EXPECT_TRUE(daal::log::FormatDeferred(formats[header.format_id], payload.data(), payload.size(),
+                                            buffer.data(), buffer.size()));
+      messages.emplace_back(buffer.data());
+    } else if (header.type == daal::log::LogRecordType::kText) {
+      messages.emplace_back(payload.begin(), payload.end());
+    }
+  }
+  std::fclose(file);
+}
+
+}  // namespace
+
+TEST(DeferredLogTest, FormatRegistryInternsByContent) {
+  auto &registry = FormatRegistry::Get();
+  const std::string kFormat{"registry {}"};
+  const std::uint16_t kId{registry.Intern(kFormat)};
+
+  ASSERT_NE(kId, FormatRegistry::kInvalidId);
+  EXPECT_EQ(registry.Intern(std::string{"registry {}"}), kId);
+  EXPECT_NE(registry.Intern("registry {} other"), kId);
+  EXPECT_EQ(std::string(registry.Lookup(kId).data(), registry.Lookup(kId).size()), kFormat);
+  EXPECT_EQ(registry.Lookup(FormatRegistry::kInvalidId).size(), 0U);
+}
+
+TEST(DeferredLogTest, EncodedArgumentsFormatLikeFmt) {
+  const std::string kString{"text"};
+  int value{-42};
+
+  EXPECT_EQ(Roundtrip("{} {} {} {}", -42, 42U, static_cast<std::uint8_t>(7), static_cast<std::int64_t>(-1)),
+            "-42 42 7 -1");
+  EXPECT_EQ(Roundtrip("{} {} {:.2f} {}", true, 'c', 3.14159, 0.5F), "true c 3.14 0.5");
+  EXPECT_EQ(Roundtrip("{} {} {}", "literal", kString, std::string_view{"view"}), "literal text view");
+  EXPECT_EQ(Roundtrip("{:>5}|{:#x}", 12, 255), "   12|0xff");
+  EXPECT_EQ(Roundtrip("{}", static_cast<const void *>(&value)), fmt::format("{}", static_cast<const void *>(&value)));
+}
+
+TEST(DeferredLogTest, EncodingFailsIfArgumentsDoNotFit) {
+  DeferredMessage message{};
+  EXPECT_FALSE(daal::log::EncodeDeferred(message, "{}", std::string(daal::log::config::kMaxDeferredArgBytes, 'x')));
+  EXPECT_FALSE(daal::log::kIsDeferrable<std::vector<int>>);
+}
+
+TEST(DeferredLogTest, MalformedArgumentsAreReported) {
+  const std::uint8_t kArgs[]{0xFF, 0x01};
+  MessageBuffer buffer{};
+
+  EXPECT_FALSE(daal::log::FormatDeferred("{}", kArgs, sizeof(kArgs), buffer.data(), buffer.size()));
+  EXPECT_STREQ(buffer.data(), "<malformed deferred message>");
+}
+
+TEST(DeferredLogTest, LoggerPassesDeferrableMessagesUnformatted) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto deferred = std::make_shared<RecordingSink>(true);
+  auto immediate = std::make_shared<RecordingSink>(false);
+  ASSERT_TRUE(logger->AddSink(deferred));
+  ASSERT_TRUE(logger->AddSink(immediate));
+
+  logger->Error("value {} of {}", 1, "two");
+  // Too long to be deferred, formatted by the caller for all sinks
+  logger->Error("{}", std::string(daal::log::config::kMaxDeferredArgBytes, 'x'));
+
+  EXPECT_EQ(deferred->Deferred(), std::vector<std::string>{"value 1 of two"});
+  EXPECT_EQ(deferred->Formatted(), std::vector<std::string>{std::string(daal::log::config::kMaxDeferredArgBytes, 'x')});
+  EXPECT_EQ(immediate->Formatted(), (std::vector<std::string>{"value 1 of two", deferred->Formatted().front()}));
+  EXPECT_TRUE(immediate->Deferred().empty());
+}
+
+TEST(DeferredLogTest, AsyncSinkFormatsOnDrainThread) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto target = std::make_shared<RecordingSink>(false);
+  auto async = std::make_shared<daal::log::AsyncSink>(target);
+  ASSERT_TRUE(logger->AddSink(async));
+
+  for (int idx = 0; idx < 10; ++idx) {
+    logger->Warning("message {} {:.1f}", idx, idx * 0.5);
+  }
+  logger->Flush();
+
+  ASSERT_EQ(target->Formatted().size(), 10U);
+  EXPECT_EQ(target->Formatted().front(), "message 0 0.0");
+  EXPECT_EQ(target->Formatted().back(), "message 9 4.5");
+}
+
+TEST(DeferredLogTest, BinaryFileSinkWritesDecodableRecords) {
+  const std::string kPath{testing::TempDir() + "deferred_log_" + std::to_string(getpid()) + ".bin"};
+  {
+    auto logger = std::make_shared<daal::log::Logger>("FILE");
+    auto sink = std::make_shared<daal::log::BinaryFileSink>(kPath);
+    ASSERT_TRUE(logger->AddSink(sink));
+    logger->Error("binary {}", 1);
+    logger->Error("binary {}", 2);
+    logger->Error("{}", std::string(daal::log::config::kMaxDeferredArgBytes, 'y'));
+    logger->Flush();
+    EXPECT_TRUE(sink->IsGood());
+  }
+
+  std::vector<daal::log::LogRecordType> types;
+  std::vector<std::string> messages;
+  ReadLogFile(kPath, types, messages);
+  std::remove(kPath.c_str());
+
+  using daal::log::LogRecordType;
+  EXPECT_EQ(types, (std::vector<LogRecordType>{LogRecordType::kContext, LogRecordType::kFormat, LogRecordType::kMessage,
+                                               LogRecordType::kMessage, LogRecordType::kText}));
+  const std::string kLong(daal::log::config::kMaxDeferredArgBytes, 'y');
+  EXPECT_EQ(messages, (std::vector<std::string>{"binary 1", "binary 2", kLong}));
+}
+
+TEST(DeferredLogTest, BinaryFileSinkKeepsRecordsOfConcurrentThreadsIntact) {
+  constexpr int kThreads{4};
+  constexpr int kMessages{500};
+  const std::string kPath{testing::TempDir() + "deferred_log_mt_" + std::to_string(getpid()) + ".bin"};
+  {
+    auto logger = std::make_shared<daal::log::Logger>("FILE");
+    auto sink = std::make_shared<daal::log::BinaryFileSink>(kPath);
+    ASSERT_TRUE(logger->AddSink(sink));
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < kThreads; ++thread) {
+      threads.emplace_back([&logger, thread]() {
+        for (int idx = 0; idx < kMessages; ++idx) {
+          logger->Error("thread {} message {}", thread, idx);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    logger->Flush();
+    EXPECT_TRUE(sink->IsGood());
+  }
+
+  std::vector<daal::log::LogRecordType> types;
+  std::vector<std::string> messages;
+  ReadLogFile(kPath, types, messages);
+  std::remove(kPath.c_str());
+
+  EXPECT_EQ(std::count(types.begin(), types.end(), daal::log::LogRecordType::kFormat), 1);
+  ASSERT_EQ(messages.size(), static_cast<std::size_t>(kThreads * kMessages));
+  for (int thread = 0; thread < kThreads; ++thread) {
+    const std::string kPrefix{"thread " + std::to_string(thread) + " message "};
+    EXPECT_EQ(std::count_if(messages.begin(), messages.end(),
+                            [&kPrefix](const std::string &message) { return message.rfind(kPrefix, 0) == 0; }),
+              kMessages);
+  }
+}
@@ -0,0 +1,130 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "daal/log/logger.hpp"
+#include "daal/log/sink.hpp"
+
+using daal::log::LogLevel;
+using daal::log::MessageBuffer;
+
+namespace {
+
+class RecordingSink : public daal::log::Sink {
+ public:
+  void ShowBuffer(LogLevel log_level, const MessageBuffer &buffer) override {
+    if (WouldShow(log_level)) {
+      std::lock_guard<std::mutex> lock{mutex_};
+      messages_.emplace_back(buffer.data());
+    }
+  }
+
+  void Flush() override {}
+
+  std::vector<std::string> Messages() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return messages_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> messages_;
+};
+
+}  // namespace
+
+TEST(LoggerTest, ShowsFormattedMessageOnAllSinks) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto first = std::make_shared<RecordingSink>();
+  auto second = std::make_shared<RecordingSink>();
+  ASSERT_TRUE(logger->AddSink(first));
+  ASSERT_TRUE(logger->AddSink(second));
+
+  logger->Error("value {} of {}", 1, "two");
+
+  ASSERT_EQ(first->Messages().size(), 1U);
+  EXPECT_EQ(first->Messages().front(), "value 1 of two");
+  EXPECT_EQ(second->Messages(), first->Messages());
+}
+
+TEST(LoggerTest, TruncatesLongMessages) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto sink = std::make_shared<RecordingSink>();
+  ASSERT_TRUE(logger->AddSink(sink));
+
+  logger->Error("{}", std::string(1000, 'x'));
+
+  ASSERT_EQ(sink->Messages().size(), 1U);
+  EXPECT_EQ(sink->Messages().front(), std::string(daal::log::config::kMaxLogMessageBufferLength - 1, 'x'));
+}
+
+TEST(LoggerTest, RejectsSinksBeyondLimit) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  for (std::size_t idx = 0; idx < daal::log::config::kMaxSinks; ++idx) {
+    EXPECT_TRUE(logger->AddSink(std::make_shared<RecordingSink>()));
+  }
+  EXPECT_FALSE(logger->AddSink(std::make_shared<RecordingSink>()));
+  EXPECT_FALSE(logger->AddSink(nullptr));
+}
+
+TEST(LoggerTest, UpdatesLimitOfAllSinks) {
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto sink = std::make_shared<RecordingSink>();
+  ASSERT_TRUE(logger->AddSink(sink));
+  EXPECT_TRUE(logger->WouldShow(LogLevel::kInfo));
+
+  sink->SetLogLevel(LogLevel::kError);
+  EXPECT_FALSE(logger->WouldShow(LogLevel::kInfo));
+  EXPECT_TRUE(logger->WouldShow(LogLevel::kError));
+
+  logger->Disable();
+  EXPECT_FALSE(logger->WouldShow(LogLevel::kFatal));
+}
+
+TEST(LoggerTest, ConcurrentLoggingDoesNotMixMessages) {
+  constexpr int kThreads{4};
+  constexpr int kMessages{2000};
+  auto logger = std::make_shared<daal::log::Logger>("TEST_");
+  auto sink = std::make_shared<RecordingSink>();
+  ASSERT_TRUE(logger->AddSink(sink));
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&logger, thread] {
+      const std::string kPayload(50 + thread * 10, static_cast<char>('a' + thread));
+      for (int idx = 0; idx < kMessages; ++idx) {
+        logger->Error("{}:{}", thread, kPayload);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const auto kResult = sink->Messages();
+  ASSERT_EQ(kResult.size(), static_cast<std::size_t>(kThreads * kMessages));
+  for (const auto &message : kResult) {
+    const int kThread{message[0] - '0'};
+    ASSERT_GE(kThread, 0);
+    ASSERT_LT(kThread, kThreads);
+    EXPECT_EQ(message, std::to_string(kThread) + ":" +
+                           std::string(50 + kThread * 10, static_cast<char>('a' + kThread)));
+  }
+}
@@ -18,6 +18,7 @@
 
 #include <chrono>
 
+#include "daal/af/trigger/wait_policy.hpp"
 #include "mocks/helper/fake_object.h"
 
 namespace daal {
@@ -66,6 +67,10 @@ class DAALSteadyClock {
   static void sleep_until(const std::chrono::steady_clock::time_point &time_point) {
     return;
   }
+
+  static void sleep_until(const std::chrono::steady_clock::time_point &time_point, const WaitPolicy &policy) {
+    return;
+  }
 };
 
 } // namespace trigger
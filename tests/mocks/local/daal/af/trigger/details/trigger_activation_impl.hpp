@@ -19,6 +19,7 @@
 #include <chrono>
 
 #include "daal/af/trigger/trigger_activation.hpp"
+#include "daal/af/trigger/wait_policy.hpp"
 #include "mocks/helper/fake_object.h"
 
 
@@ -40,6 +41,12 @@ class PeriodicActivationMock : public FakeObject<PeriodicActivationMock> {
    * @return The result of the wait operation.
    */
   MOCK_METHOD(uint64_t, Wait, (), ());
+
+  /**
+   * @brief Mock method for simulating the wake-up jitter.
+   * @return The jitter of the last wait operation.
+   */
+  MOCK_METHOD(std::chrono::nanoseconds, GetWakeUpJitter, (), ());
 };
 
 /**
@@ -52,7 +59,11 @@ class PeriodicActivation : public daal::af::trigger::TriggerActivation {
    * @brief Constructs a PeriodicActivation object with the specified period.
    * @param period The period between activations.
    */
-  PeriodicActivation(std::chrono::nanoseconds period) : period_{period} {}
+  PeriodicActivation(std::chrono::nanoseconds period,
+                     std::chrono::nanoseconds offset = std::chrono::nanoseconds(0),
+                     WaitPolicy wait_policy = WaitPolicy{},
+                     std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::time_point{})
+      : period_{period} {}
 
   /**
    * @brief Maps the original Wait call to fake object.
@@ -62,6 +73,27 @@ class PeriodicActivation : public daal::af::trigger::TriggerActivation {
     return FakeObject<PeriodicActivationMock>::GetFakeObject()->Wait();
   };
 
+  /**
+   * @brief Maps the original GetWakeUpJitter call to fake object.
+   * @return The jitter of the Fake object.
+   */
+  std::chrono::nanoseconds GetWakeUpJitter() const override {
+    return FakeObject<PeriodicActivationMock>::GetFakeObject()->GetWakeUpJitter();
+  };
+
+  /**
+   * @brief Stores the period like the original.
+   */
+  bool SetPeriod(std::chrono::nanoseconds period) {
+    period_ = period;
+    return period.count() > 0;
+  }
+
+  /**
+   * @brief Returns the stored period.
+   */
+  std::chrono::nanoseconds GetPeriod() const { return period_; }
+
  private:
   std::chrono::nanoseconds period_; /**< The period between activations. */
 };
@@ -18,6 +18,7 @@
 #include <chrono>
 
 #include "daal/af/trigger/trigger.hpp"
+#include "daal/af/trigger/wait_policy.hpp"
 
 struct PeriodicTriggerMock {
   static PeriodicTriggerMock& instance() {
@@ -33,7 +34,7 @@ namespace af {
 namespace trigger {
 
 struct PeriodicTrigger : public Trigger {
-  PeriodicTrigger(std::chrono::nanoseconds period) {
+  PeriodicTrigger(std::chrono::nanoseconds period, WaitPolicy wait_policy = WaitPolicy{}) {
     PeriodicTriggerMock::instance().ctor(period);
   }
 
@@ -0,0 +1,226 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "daal/af/runtime_statistics/details/histogram_report.hpp"
+#include "daal/af/runtime_statistics/latency_histogram.hpp"
+#include "daal/af/runtime_statistics/reporting_backend.hpp"
+#include "daal/af/runtime_statistics/runtime_statistics.hpp"
+
+using daal::af::runtime_statistics::IReportingBackend;
+using daal::af::runtime_statistics::LatencyHistogram;
+using daal::af::runtime_statistics::RuntimeStatistics;
+using daal::af::runtime_statistics::TimeProvider;
+
+namespace {
+
+/** Manually advanced clock, CPU time equals real time. */
+class ScriptedTimeProvider : public TimeProvider {
+ public:
+  std::uint64_t GetRealTime() noexcept override { return real_; }
+  std::uint64_t GetCPUTime() noexcept override { return real_; }
+
+  void Advance(std::uint64_t delta) noexcept { real_ += delta; }
+
+ private:
+  std::uint64_t real_{1000};
+};
+
+class NullBackend : public IReportingBackend {
+ public:
+  void Show(const RuntimeStatistics::Statistics&) noexcept override {}
+};
+
+/** Run one cycle with the given execution time and a fixed period of 1000 µs. */
+void RunCycle(RuntimeStatistics& statistics, ScriptedTimeProvider& time, std::uint64_t execution_time) {
+  statistics.StartMeasurement();
+  time.Advance(execution_time);
+  statistics.StopMeasurement();
+  time.Advance(1000 - execution_time);
+}
+
+}  // namespace
+
+TEST(LatencyHistogramTest, SmallValuesAreCountedExactly) {
+  for (std::uint64_t value = 0; value < 2 * LatencyHistogram::kSubBuckets; ++value) {
+    const auto kBucket = LatencyHistogram::BucketIndex(value);
+    EXPECT_EQ(kBucket, value);
+    EXPECT_EQ(LatencyHistogram::HighestValueAt(kBucket), value);
+  }
+}
+
+TEST(LatencyHistogramTest, BucketsCoverValuesWithBoundedError) {
+  std::size_t previous{0};
+  for (std::uint64_t value = 1; value < (1ULL << 20); value = value * 9 / 8 + 1) {
+    const auto kBucket = LatencyHistogram::BucketIndex(value);
+    const auto kHighest = LatencyHistogram::HighestValueAt(kBucket);
+    EXPECT_GE(kBucket, previous);
+    EXPECT_GE(kHighest, value);
+    EXPECT_LE(kHighest - value, value / LatencyHistogram::kSubBuckets);
+    previous = kBucket;
+  }
+  EXPECT_EQ(LatencyHistogram::BucketIndex(LatencyHistogram::kMaxTrackableValue), LatencyHistogram::kBucketCount - 1);
+  EXPECT_EQ(LatencyHistogram::BucketIndex(~0ULL), LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyHistogramTest, PercentilesAndReset) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Percentile(50.0), 0U);
+
+  for (int idx = 0; idx < 990; ++idx) {
+    histogram.Record(10);
+  }
+  for (int idx = 0; idx < 9; ++idx) {
+    histogram.Record(1000);
+  }
+  histogram.Record(100000);
+
+  EXPECT_EQ(histogram.TotalCount(), 1000U);
+  EXPECT_EQ(histogram.Percentile(50.0), 10U);
+  EXPECT_EQ(histogram.Percentile(99.0), 10U);
+  EXPECT_EQ(histogram.Percentile(99.9), LatencyHistogram::HighestValueAt(LatencyHistogram::BucketIndex(1000)));
+  EXPECT_EQ(histogram.Percentile(100.0), LatencyHistogram::HighestValueAt(LatencyHistogram::BucketIndex(100000)));
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.TotalCount(), 0U);
+  EXPECT_EQ(histogram.CountAt(LatencyHistogram::BucketIndex(10)), 0U);
+  EXPECT_EQ(histogram.Percentile(50.0), 0U);
+}
+
+TEST(RuntimeStatisticsHistogramTest, PercentilesShowOutliersHiddenByMean) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F);
+  ASSERT_EQ(statistics.GetMode(), RuntimeStatistics::Mode::kHistogram);
+
+  for (int idx = 0; idx < 1000; ++idx) {
+    RunCycle(statistics, *time, idx % 100 == 99 ? 500 : 20);
+  }
+
+  const auto& data = statistics.Get().gross_execution_time;
+  ASSERT_NE(data.histogram, nullptr);
+  EXPECT_EQ(data.histogram, statistics.GetHistogram(RuntimeStatistics::Metric::kGrossExecutionTime));
+  EXPECT_FLOAT_EQ(data.p50, 20.0F);
+  EXPECT_GE(data.p99_9, 500.0F);
+  EXPECT_LE(data.p99_9, 500.0F * (1.0F + 1.0F / LatencyHistogram::kSubBuckets));
+  EXPECT_LT(data.mean, 30.0F);
+
+  statistics.Reset();
+  EXPECT_EQ(statistics.GetHistogram(RuntimeStatistics::Metric::kGrossExecutionTime)->TotalCount(), 0U);
+  EXPECT_NE(statistics.Get().gross_execution_time.histogram, nullptr);
+}
+
+TEST(RuntimeStatisticsHistogramTest, BasicModeHasNoHistogram) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F,
+                               RuntimeStatistics::Mode::kBasic);
+  for (int idx = 0; idx < 10; ++idx) {
+    RunCycle(statistics, *time, 20);
+  }
+
+  EXPECT_EQ(statistics.GetMode(), RuntimeStatistics::Mode::kBasic);
+  EXPECT_EQ(statistics.GetHistogram(RuntimeStatistics::Metric::kDeltaTime), nullptr);
+  const auto& result = statistics.Get();
+  EXPECT_EQ(result.delta_time.histogram, nullptr);
+  EXPECT_FLOAT_EQ(result.delta_time.p99, 0.0F);
+
+  std::ostringstream report;
+  daal::af::runtime_statistics::WriteHistogramReports(report, result);
+  EXPECT_TRUE(report.str().empty());
+}
+
+TEST(RuntimeStatisticsHistogramTest, ReportContainsPercentilesAndBuckets) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F);
+  for (int idx = 0; idx < 10; ++idx) {
+    RunCycle(statistics, *time, 20);
+  }
+
+  std::ostringstream report;
+  daal::af::runtime_statistics::WriteHistogramReports(report, statistics.Get());
+  const std::string kReport{report.str()};
+  EXPECT_NE(kReport.find("\"GET_P50\" : 20"), std::string::npos);
+  const auto kPeriodBucket = LatencyHistogram::HighestValueAt(LatencyHistogram::BucketIndex(1000));
+  EXPECT_NE(kReport.find("\"DT_P99_99\" : " + std::to_string(kPeriodBucket)), std::string::npos);
+  // The first cycle has no period yet and is not counted
+  EXPECT_NE(kReport.find("\"GET_HISTOGRAM\" : [ [20, 9] ]"), std::string::npos);
+}
+
+TEST(RuntimeStatisticsDeadlineTest, CountsOverrunsAgainstBudget) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F);
+  RunCycle(statistics, *time, 20);
+
+  RunCycle(statistics, *time, 500);
+  EXPECT_FALSE(statistics.IsOverrun());
+  EXPECT_EQ(statistics.Get().overrun_count, 0U);
+
+  statistics.SetExecutionBudget(100);
+  RunCycle(statistics, *time, 500);
+  EXPECT_TRUE(statistics.IsOverrun());
+  RunCycle(statistics, *time, 100);
+  EXPECT_FALSE(statistics.IsOverrun());
+  RunCycle(statistics, *time, 101);
+  EXPECT_TRUE(statistics.IsOverrun());
+  EXPECT_EQ(statistics.Get().overrun_count, 2U);
+
+  statistics.Reset();
+  EXPECT_EQ(statistics.Get().overrun_count, 0U);
+  EXPECT_FALSE(statistics.IsOverrun());
+}
+
+TEST(RuntimeStatisticsDeadlineTest, CollectsMissedCyclesAndWakeUpJitter) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F);
+  RunCycle(statistics, *time, 20);
+
+  statistics.RecordActivation(0, 10);
+  RunCycle(statistics, *time, 20);
+  statistics.RecordActivation(3, 30);
+  RunCycle(statistics, *time, 20);
+  statistics.RecordActivation(1, 20);
+  RunCycle(statistics, *time, 20);
+
+  const auto& result = statistics.Get();
+  EXPECT_EQ(result.missed_cycles, 4U);
+  EXPECT_EQ(result.cycle_count, 3U);
+  EXPECT_FLOAT_EQ(result.wakeup_jitter.minimum, 10.0F);
+  EXPECT_FLOAT_EQ(result.wakeup_jitter.maximum, 30.0F);
+  EXPECT_FLOAT_EQ(result.wakeup_jitter.mean, 20.0F);
+  EXPECT_EQ(statistics.GetHistogram(RuntimeStatistics::Metric::kWakeUpJitter)->TotalCount(), 3U);
+
+  std::ostringstream report;
+  daal::af::runtime_statistics::WriteHistogramReports(report, result);
+  EXPECT_NE(report.str().find("\"WJ_HISTOGRAM\" : [ [10, 1], [20, 1], [30, 1] ]"), std::string::npos);
+
+  statistics.Reset();
+  EXPECT_EQ(statistics.Get().missed_cycles, 0U);
+  EXPECT_EQ(statistics.Get().wakeup_jitter.histogram->TotalCount(), 0U);
+}
+
+TEST(RuntimeStatisticsDeadlineTest, DisabledStatisticsIgnoreActivations) {
+  auto time = std::make_shared<ScriptedTimeProvider>();
+  RuntimeStatistics statistics("module", time, std::make_shared<NullBackend>(), 0.0F);
+  statistics.Disable();
+  statistics.RecordActivation(5, 10);
+  statistics.Enable();
+  RunCycle(statistics, *time, 20);
+  RunCycle(statistics, *time, 20);
+
+  EXPECT_EQ(statistics.Get().missed_cycles, 0U);
+}
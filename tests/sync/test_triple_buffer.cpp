@@ -0,0 +1,94 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "daal/af/sync/triple_buffer.hpp"
+
+using daal::af::sync::TripleBuffer;
+
+TEST(TripleBufferTest, FrontIsInitialUntilPublished) {
+  TripleBuffer<int> buffer{7};
+  EXPECT_EQ(buffer.GetFront(), 7);
+  EXPECT_FALSE(buffer.Consume());
+  EXPECT_EQ(buffer.GetFront(), 7);
+}
+
+TEST(TripleBufferTest, ConsumeTakesLatestPublishedValue) {
+  TripleBuffer<int> buffer;
+  buffer.GetBack() = 1;
+  buffer.Publish();
+  buffer.GetBack() = 2;
+  buffer.Publish();
+
+  EXPECT_TRUE(buffer.Consume());
+  EXPECT_EQ(buffer.GetFront(), 2);
+  EXPECT_FALSE(buffer.Consume());
+  EXPECT_EQ(buffer.GetFront(), 2);
+}
+
+TEST(TripleBufferTest, FrontIsStableWhileProducerPublishes) {
+  TripleBuffer<int> buffer;
+  buffer.GetBack() = 1;
+  buffer.Publish();
+  ASSERT_TRUE(buffer.Consume());
+  const int* front{&buffer.GetFront()};
+
+  for (int value = 2; value < 10; ++value) {
+    buffer.GetBack() = value;
+    EXPECT_NE(&buffer.GetBack(), front);
+    buffer.Publish();
+  }
+  EXPECT_EQ(*front, 1);
+  EXPECT_TRUE(buffer.Consume());
+  EXPECT_EQ(buffer.GetFront(), 9);
+}
+
+TEST(TripleBufferTest, ConcurrentValuesAreNeverTorn) {
+  using Sample = std::array<std::uint64_t, 32>;
+  constexpr std::uint64_t kSamples{200000};
+  TripleBuffer<Sample> buffer;
+  std::atomic<bool> done{false};
+
+  std::thread producer{[&buffer, &done]() {
+    for (std::uint64_t sequence = 1; sequence <= kSamples; ++sequence) {
+      buffer.GetBack().fill(sequence);
+      buffer.Publish();
+    }
+    done = true;
+  }};
+
+  std::uint64_t last{0};
+  bool consistent{true};
+  bool finished{false};
+  while (!finished) {
+    finished = done.load();
+    if (buffer.Consume()) {
+      const Sample& sample{buffer.GetFront()};
+      for (const auto value : sample) {
+        consistent = consistent && (value == sample[0]);
+      }
+      consistent = consistent && (sample[0] > last);
+      last = sample[0];
+    }
+  }
+  producer.join();
+
+  EXPECT_TRUE(consistent);
+  EXPECT_EQ(last, kSamples);
+}
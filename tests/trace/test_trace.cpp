@@ -0,0 +1,134 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "daal/af/trace/trace.hpp"
+
+using namespace daal::af::trace;
+
+namespace {
+
+struct DumpedBuffer {
+  TraceBufferHeader header;
+  std::vector<TraceRecord> records;
+};
+
+std::vector<DumpedBuffer> ReadDump(const std::string &path) {
+  std::vector<DumpedBuffer> buffers;
+  std::FILE *file{std::fopen(path.c_str(), "rb")};
+  if (nullptr == file) {
+    return buffers;
+  }
+  TraceFileHeader file_header{};
+  if (std::fread(&file_header, sizeof(file_header), 1, file) == 1 && file_header.magic == kTraceFileMagic) {
+    for (std::uint32_t idx = 0; idx < file_header.buffer_count; ++idx) {
+      DumpedBuffer buffer{};
+      if (std::fread(&buffer.header, sizeof(buffer.header), 1, file) != 1) {
+        break;
+      }
+      buffer.records.resize(buffer.header.record_count);
+      if (std::fread(buffer.records.data(), sizeof(TraceRecord), buffer.records.size(), file) !=
+          buffer.records.size()) {
+        break;
+      }
+      buffers.push_back(buffer);
+    }
+  }
+  std::fclose(file);
+  return buffers;
+}
+
+}  // namespace
+
+class TraceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!config::kTracingEnabled) {
+      GTEST_SKIP() << "Tracing is disabled in this build";
+    }
+  }
+
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  std::string path_{::testing::TempDir() + "daal_trace_test.bin"};
+};
+
+TEST_F(TraceTest, RecordsOfAllThreadsAreDumped) {
+  std::thread worker([]() { Trace(TraceEvent::kSubmit, 77); });
+  worker.join();
+  Trace(TraceEvent::kFork, 42);
+
+  ASSERT_TRUE(DumpTraces(path_));
+  auto buffers = ReadDump(path_);
+  ASSERT_GE(buffers.size(), 2U);
+
+  bool found_fork{false};
+  bool found_submit{false};
+  for (const auto &buffer : buffers) {
+    for (const auto &record : buffer.records) {
+      found_fork = found_fork || (record.event == TraceEvent::kFork && record.argument == 42);
+      found_submit = found_submit || (record.event == TraceEvent::kSubmit && record.argument == 77);
+    }
+  }
+  EXPECT_TRUE(found_fork);
+  EXPECT_TRUE(found_submit);
+}
+
+TEST_F(TraceTest, RecordsAreOrderedPerThread) {
+  std::thread worker([]() {
+    Trace(TraceEvent::kJoinStart);
+    Trace(TraceEvent::kJoinEnd);
+  });
+  worker.join();
+
+  ASSERT_TRUE(DumpTraces(path_));
+  auto buffers = ReadDump(path_);
+  ASSERT_FALSE(buffers.empty());
+  const auto &records = buffers.back().records;
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_EQ(records[0].event, TraceEvent::kJoinStart);
+  EXPECT_EQ(records[1].event, TraceEvent::kJoinEnd);
+  EXPECT_LE(records[0].timestamp_ns, records[1].timestamp_ns);
+}
+
+TEST_F(TraceTest, OverwrittenRecordsAreCountedAsLost) {
+  constexpr std::uint32_t kExtra{10};
+  std::thread worker([]() {
+    for (std::uint32_t idx = 0; idx < config::kTraceBufferCapacity + kExtra; ++idx) {
+      Trace(TraceEvent::kNodeStart, idx);
+    }
+  });
+  worker.join();
+
+  ASSERT_TRUE(DumpTraces(path_));
+  auto buffers = ReadDump(path_);
+  ASSERT_FALSE(buffers.empty());
+  const auto &buffer = buffers.back();
+  EXPECT_EQ(buffer.header.lost_count, kExtra);
+  ASSERT_EQ(buffer.records.size(), config::kTraceBufferCapacity);
+  EXPECT_EQ(buffer.records.front().argument, kExtra);
+  EXPECT_EQ(buffer.records.back().argument, config::kTraceBufferCapacity + kExtra - 1);
+}
+
+TEST(TraceEventTest, EventsHaveNames) {
+  EXPECT_STREQ(ToString(TraceEvent::kFork), "fork");
+  EXPECT_STREQ(ToString(TraceEvent::kJoinEnd), "join_end");
+}
+
+TEST(TraceDumpTest, InvalidPathFails) { EXPECT_FALSE(DumpTraces("/nonexistent/dir/trace.bin")); }
@@ -0,0 +1,103 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "daal/af/trigger/details/cluster_schedule.hpp"
+#include "daal/af/trigger/details/daal_steady_clock.hpp"
+#include "daal/af/trigger/details/trigger_activation_impl.hpp"
+
+using namespace std::chrono_literals;
+
+using daal::af::trigger::ClusterSchedule;
+using daal::af::trigger::ClusterSlot;
+
+class ClusterScheduleTest : public ::testing::Test {
+ protected:
+  void TearDown() override { (void)std::remove(path_.c_str()); }
+
+  const std::string path_{::testing::TempDir() + "daal_cluster_schedule_" + std::to_string(getpid())};
+};
+
+TEST_F(ClusterScheduleTest, WrittenSlotsAreFoundByName) {
+  const std::chrono::steady_clock::time_point kEpoch{123456789ns};
+  ASSERT_TRUE(ClusterSchedule::Write(path_, {{"radar", 10ms, 0ms, {}}, {"fusion", 10ms, 2500us, {}}}, kEpoch));
+
+  auto schedule = ClusterSchedule::Open(path_);
+  ASSERT_NE(schedule, nullptr);
+  EXPECT_EQ(schedule->Size(), 2U);
+  EXPECT_EQ(schedule->GetEpoch(), kEpoch);
+
+  const auto kFusion = schedule->FindSlot("fusion");
+  ASSERT_TRUE(kFusion.has_value());
+  EXPECT_EQ(kFusion->name, "fusion");
+  EXPECT_EQ(kFusion->period, 10ms);
+  EXPECT_EQ(kFusion->offset, 2500us);
+  EXPECT_EQ(kFusion->epoch, kEpoch);
+  EXPECT_FALSE(schedule->FindSlot("camera").has_value());
+  EXPECT_FALSE(schedule->FindSlot("rad").has_value());
+}
+
+TEST_F(ClusterScheduleTest, RewriteReplacesScheduleForNewReaders) {
+  ASSERT_TRUE(ClusterSchedule::Write(path_, {{"radar", 10ms, 0ms, {}}}));
+  auto old_schedule = ClusterSchedule::Open(path_);
+  ASSERT_NE(old_schedule, nullptr);
+
+  ASSERT_TRUE(ClusterSchedule::Write(path_, {{"radar", 20ms, 5ms, {}}}));
+  auto new_schedule = ClusterSchedule::Open(path_);
+  ASSERT_NE(new_schedule, nullptr);
+  EXPECT_EQ(old_schedule->FindSlot("radar")->period, 10ms);
+  EXPECT_EQ(new_schedule->FindSlot("radar")->period, 20ms);
+}
+
+TEST_F(ClusterScheduleTest, InvalidSlotsAreRejected) {
+  EXPECT_FALSE(ClusterSchedule::Write(path_, {{"radar", 10ms, 10ms, {}}}));
+  EXPECT_FALSE(ClusterSchedule::Write(path_, {{"radar", 0ms, 0ms, {}}}));
+  EXPECT_FALSE(ClusterSchedule::Write(path_, {{"", 10ms, 0ms, {}}}));
+  EXPECT_FALSE(ClusterSchedule::Write(path_, {{std::string(40, 'x'), 10ms, 0ms, {}}}));
+  EXPECT_FALSE(ClusterSchedule::Write(path_, {{"radar", 10ms, 0ms, {}}, {"radar", 10ms, 1ms, {}}}));
+  EXPECT_EQ(ClusterSchedule::Open(path_), nullptr);
+}
+
+TEST_F(ClusterScheduleTest, OpenRejectsForeignFiles) {
+  EXPECT_EQ(ClusterSchedule::Open(path_), nullptr);
+
+  std::FILE *file{std::fopen(path_.c_str(), "wb")};
+  ASSERT_NE(file, nullptr);
+  const std::string kContent{"this is not a schedule file at all"};
+  ASSERT_EQ(std::fwrite(kContent.data(), 1, kContent.size(), file), kContent.size());
+  ASSERT_EQ(std::fclose(file), 0);
+  EXPECT_EQ(ClusterSchedule::Open(path_), nullptr);
+}
+
+TEST_F(ClusterScheduleTest, ActivationsArePhaseLockedToTheEpoch) {
+  const auto kEpoch = daal::af::trigger::DAALSteadyClock::now() - 3ms;
+  ASSERT_TRUE(ClusterSchedule::Write(path_, {{"consumer", 4ms, 1ms, {}}}, kEpoch));
+  auto schedule = ClusterSchedule::Open(path_);
+  ASSERT_NE(schedule, nullptr);
+  const auto kSlot = schedule->FindSlot("consumer");
+  ASSERT_TRUE(kSlot.has_value());
+
+  daal::af::trigger::PeriodicActivation activation{kSlot->period, kSlot->offset, {}, kSlot->epoch};
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    (void)activation.Wait();
+    const auto kPhase = (daal::af::trigger::DAALSteadyClock::now() - kEpoch - kSlot->offset) % kSlot->period;
+    // Woken shortly after a slot of the grid
+    EXPECT_LT(kPhase, kSlot->period / 2);
+  }
+}
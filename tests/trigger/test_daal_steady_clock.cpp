@@ -43,3 +43,24 @@ TEST_F(DAALSteadyClockTest, Now_ReturnsCurrentTime) {
   EXPECT_GE(actualTime.time_since_epoch().count(),
             expectedTime.time_since_epoch().count());
 }
+
+class DAALSteadyClockWaitTest : public ::testing::TestWithParam<WaitStrategy> {};
+
+TEST_P(DAALSteadyClockWaitTest, SleepUntil_DoesNotWakeUpEarly) {
+  const WaitPolicy policy{GetParam(), microseconds{200}};
+  for (int cycle = 0; cycle < 10; ++cycle) {
+    const auto wakeup_time = DAALSteadyClock::now() + milliseconds{1};
+    DAALSteadyClock::sleep_until(wakeup_time, policy);
+    EXPECT_GE(DAALSteadyClock::now(), wakeup_time);
+  }
+}
+
+TEST_P(DAALSteadyClockWaitTest, SleepUntil_PastTimePointReturnsImmediately) {
+  const WaitPolicy policy{GetParam(), microseconds{200}};
+  const auto start = DAALSteadyClock::now();
+  DAALSteadyClock::sleep_until(start - milliseconds{1}, policy);
+  EXPECT_LT(DAALSteadyClock::now() - start, milliseconds{100});
+}
+
+INSTANTIATE_TEST_SUITE_P(WaitStrategies, DAALSteadyClockWaitTest,
+                         ::testing::Values(WaitStrategy::kSleep, WaitStrategy::kSpin, WaitStrategy::kHybrid));
@@ -0,0 +1,99 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "daal/af/sync/data_ready_signal.hpp"
+#include "daal/af/trigger/details/event_trigger.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(DataReadySignalTest, WaitForTimesOutWithoutNotification) {
+  daal::af::sync::DataReadySignal signal;
+  const auto kStart = std::chrono::steady_clock::now();
+  EXPECT_FALSE(signal.WaitFor(signal.GetEpoch(), 20ms));
+  EXPECT_GE(std::chrono::steady_clock::now() - kStart, 20ms);
+}
+
+TEST(DataReadySignalTest, WaitForReturnsImmediatelyAfterEarlierNotification) {
+  daal::af::sync::DataReadySignal signal;
+  const std::uint32_t kSeen{signal.GetEpoch()};
+  signal.Notify();
+  EXPECT_TRUE(signal.WaitFor(kSeen, 0ns));
+  EXPECT_EQ(signal.GetEpoch(), kSeen + 1);
+}
+
+TEST(DataReadySignalTest, NotifyWakesSleepingConsumer) {
+  daal::af::sync::DataReadySignal signal;
+  const std::uint32_t kSeen{signal.GetEpoch()};
+  std::thread producer{[&signal]() {
+    std::this_thread::sleep_for(10ms);
+    signal.Notify();
+  }};
+  const auto kStart = std::chrono::steady_clock::now();
+  EXPECT_TRUE(signal.WaitFor(kSeen, 5s));
+  EXPECT_LT(std::chrono::steady_clock::now() - kStart, 5s);
+  producer.join();
+}
+
+TEST(EventTriggerTest, TimeoutReportsNotTriggered) {
+  daal::af::sync::DataReadySignal signal;
+  daal::af::trigger::EventTrigger trigger{signal, 10ms};
+  EXPECT_FALSE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetNotificationCount(), 0U);
+  EXPECT_EQ(trigger.GetActivationStatus().missed_cycles, 0U);
+}
+
+TEST(EventTriggerTest, NotificationsBeforeConstructionAreIgnored) {
+  daal::af::sync::DataReadySignal signal;
+  signal.Notify();
+  daal::af::trigger::EventTrigger trigger{signal, 10ms};
+  EXPECT_FALSE(trigger.CheckTriggerConditionAndWait());
+}
+
+TEST(EventTriggerTest, NotificationsDuringCycleAreCoalesced) {
+  daal::af::sync::DataReadySignal signal;
+  daal::af::trigger::EventTrigger trigger{signal, 5s};
+  signal.Notify();
+  signal.Notify();
+  signal.Notify();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetNotificationCount(), 3U);
+  EXPECT_EQ(trigger.GetActivationStatus().wakeup_jitter, 0ns);
+
+  signal.Notify();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetNotificationCount(), 1U);
+}
+
+TEST(EventTriggerTest, ActivatesOnDataFromAnotherThread) {
+  constexpr int kSamples{20};
+  daal::af::sync::DataReadySignal signal;
+  daal::af::trigger::EventTrigger trigger{signal, 5s};
+  std::thread producer{[&signal]() {
+    for (int sample = 0; sample < kSamples; ++sample) {
+      std::this_thread::sleep_for(1ms);
+      signal.Notify();
+    }
+  }};
+  std::uint32_t handled{0};
+  while (handled < kSamples) {
+    ASSERT_TRUE(trigger.CheckTriggerConditionAndWait());
+    handled += trigger.GetNotificationCount();
+  }
+  EXPECT_EQ(handled, static_cast<std::uint32_t>(kSamples));
+  producer.join();
+}
@@ -0,0 +1,118 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "daal/af/sync/data_ready_signal.hpp"
+#include "daal/af/trigger/details/hybrid_trigger.hpp"
+
+using namespace std::chrono_literals;
+
+using daal::af::sync::DataReadySignal;
+using daal::af::trigger::HybridTrigger;
+using daal::af::trigger::WakeupCause;
+
+class HybridTriggerTest : public ::testing::Test {
+ protected:
+  DataReadySignal group_{};
+  DataReadySignal camera_{group_};
+  DataReadySignal radar_{group_};
+};
+
+TEST_F(HybridTriggerTest, ActivatesWhenAllRequiredInputsAreReady) {
+  HybridTrigger trigger{group_, {camera_, radar_}, 2, 10s, 10s};
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kNone);
+  camera_.Notify();
+  radar_.Notify();
+  const auto kStart = std::chrono::steady_clock::now();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_LT(std::chrono::steady_clock::now() - kStart, 1s);
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kDataReady);
+  EXPECT_EQ(trigger.GetReadyInputCount(), 2U);
+  EXPECT_EQ(trigger.GetActivationStatus().missed_cycles, 0U);
+}
+
+TEST_F(HybridTriggerTest, ActivatesOnDataFromProducerThreads) {
+  HybridTrigger trigger{group_, {camera_, radar_}, 2, 10s, 10s};
+  std::thread camera{[this]() {
+    std::this_thread::sleep_for(2ms);
+    camera_.Notify();
+  }};
+  std::thread radar{[this]() {
+    std::this_thread::sleep_for(5ms);
+    radar_.Notify();
+  }};
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kDataReady);
+  EXPECT_EQ(trigger.GetReadyInputCount(), 2U);
+  camera.join();
+  radar.join();
+}
+
+TEST_F(HybridTriggerTest, ActivatesOnNOfMInputs) {
+  DataReadySignal lidar{group_};
+  HybridTrigger trigger{group_, {camera_, radar_, lidar}, 2, 10s, 10s};
+  lidar.Notify();
+  camera_.Notify();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kDataReady);
+  EXPECT_EQ(trigger.GetReadyInputCount(), 2U);
+}
+
+TEST_F(HybridTriggerTest, PartialDataActivatesAfterMaxLatency) {
+  HybridTrigger trigger{group_, {camera_, radar_}, 2, 10s, 20ms};
+  camera_.Notify();
+  const auto kStart = std::chrono::steady_clock::now();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_GE(std::chrono::steady_clock::now() - kStart, 20ms);
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kTimeout);
+  EXPECT_EQ(trigger.GetReadyInputCount(), 1U);
+}
+
+TEST_F(HybridTriggerTest, ActivatesOnPeriodWithoutData) {
+  HybridTrigger trigger{group_, {camera_, radar_}, 2, 20ms, 10s};
+  for (int cycle = 0; cycle < 3; ++cycle) {
+    EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+    EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kPeriod);
+    EXPECT_EQ(trigger.GetReadyInputCount(), 0U);
+  }
+}
+
+TEST_F(HybridTriggerTest, DataIsConsumedByEveryActivation) {
+  HybridTrigger trigger{group_, {camera_, radar_}, 1, 20ms, 10s};
+  camera_.Notify();
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_EQ(trigger.GetWakeupCause(), WakeupCause::kDataReady);
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_NE(trigger.GetWakeupCause(), WakeupCause::kDataReady);
+}
+
+TEST_F(HybridTriggerTest, InvalidRequiredCountExits) {
+  EXPECT_EXIT(HybridTrigger(group_, {camera_, radar_}, 0, 10ms, 10ms), ::testing::ExitedWithCode(42), "");
+  EXPECT_EXIT(HybridTrigger(group_, {camera_, radar_}, 3, 10ms, 10ms), ::testing::ExitedWithCode(42), "");
+}
+
+TEST_F(HybridTriggerTest, InputOutsideGroupExits) {
+  DataReadySignal ungrouped{};
+  EXPECT_EXIT(HybridTrigger(group_, {camera_, ungrouped}, 2, 10ms, 10ms), ::testing::ExitedWithCode(42), "");
+}
+
+TEST(WakeupCauseTest, ToString) {
+  EXPECT_EQ(std::string{daal::af::trigger::ToString(WakeupCause::kDataReady)}, "data_ready");
+  EXPECT_EQ(std::string{daal::af::trigger::ToString(WakeupCause::kPeriod)}, "period");
+  EXPECT_EQ(std::string{daal::af::trigger::ToString(WakeupCause::kTimeout)}, "timeout");
+}
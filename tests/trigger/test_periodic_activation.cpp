@@ -215,3 +215,73 @@ TEST_F(PeriodicActivationTest, Wait_NextExpectedTimeToWakeUpMiss) {
   EXPECT_EQ(activation.Wait(), 0);
   EXPECT_EQ(activation.Wait(), 1);
 }
+
+TEST_F(PeriodicActivationTest, Wait_ReportsWakeUpJitterOfServedSlot) {
+  // Start aligned to the period, the first slot is one period later
+  const std::chrono::steady_clock::time_point start{period_ * 1000};
+  EXPECT_CALL(*fake, Now())
+      .Times(3)
+      .WillOnce(testing::Return(start))
+      .WillOnce(testing::Return(start + period_ + jitter_))
+      .WillOnce(testing::Return(start + 4 * period_ + 3 * jitter_));
+
+  daal::af::trigger::PeriodicActivation activation{period_};
+  EXPECT_EQ(activation.GetWakeUpJitter(), 0ns);
+
+  EXPECT_EQ(activation.Wait(), 0);
+  EXPECT_EQ(activation.GetWakeUpJitter(), jitter_);
+
+  // Two slots missed, the jitter refers to the slot served now
+  EXPECT_EQ(activation.Wait(), 2);
+  EXPECT_EQ(activation.GetWakeUpJitter(), 3 * jitter_);
+}
+
+TEST_F(PeriodicActivationTest, CTOR_WithNegativeSpinMargin_ShouldDie) {
+  testing::Mock::AllowLeak(fake.get());
+  const daal::af::trigger::WaitPolicy policy{daal::af::trigger::WaitStrategy::kHybrid, -1us};
+  EXPECT_EXIT({ daal::af::trigger::PeriodicActivation activation(100ms, 0ns, policy); },
+              ::testing::ExitedWithCode(42), "");
+}
+
+TEST_F(PeriodicActivationTest, Wait_WithHybridPolicy_ServesSlots) {
+  const std::chrono::steady_clock::time_point start{period_ * 1000};
+  EXPECT_CALL(*fake, Now())
+      .Times(3)
+      .WillOnce(testing::Return(start))
+      .WillOnce(testing::Return(start + period_))
+      .WillOnce(testing::Return(start + 2 * period_));
+
+  const daal::af::trigger::WaitPolicy policy{daal::af::trigger::WaitStrategy::kHybrid, 20ns};
+  daal::af::trigger::PeriodicActivation activation{period_, 0ns, policy};
+  EXPECT_EQ(activation.Wait(), 0);
+  EXPECT_EQ(activation.GetWakeUpJitter(), 0ns);
+  EXPECT_EQ(activation.Wait(), 0);
+}
+
+TEST_F(PeriodicActivationTest, Wait_WithEpoch_AlignsToEpochGrid) {
+  // The epoch lies 30ns before the start, the first slot is epoch + period + offset
+  const std::chrono::steady_clock::time_point start{period_ * 1000 + 7ns};
+  const std::chrono::steady_clock::time_point epoch{start - 30ns};
+  EXPECT_CALL(*fake, Now())
+      .Times(3)
+      .WillOnce(testing::Return(start))
+      .WillOnce(testing::Return(epoch + period_ + offset_ + jitter_))
+      .WillOnce(testing::Return(epoch + 2 * period_ + offset_));
+
+  daal::af::trigger::PeriodicActivation activation{period_, offset_, daal::af::trigger::WaitPolicy{}, epoch};
+  EXPECT_EQ(activation.Wait(), 0);
+  EXPECT_EQ(activation.GetWakeUpJitter(), jitter_);
+  EXPECT_EQ(activation.Wait(), 0);
+  EXPECT_EQ(activation.GetWakeUpJitter(), 0ns);
+}
+
+TEST_F(PeriodicActivationTest, SetPeriod_RejectsNonPositivePeriod) {
+  EXPECT_CALL(*fake, Now()).WillRepeatedly(testing::Return(time_now_));
+
+  daal::af::trigger::PeriodicActivation activation{period_};
+  EXPECT_FALSE(activation.SetPeriod(0ns));
+  EXPECT_FALSE(activation.SetPeriod(-period_));
+  EXPECT_EQ(activation.GetPeriod(), period_);
+  EXPECT_TRUE(activation.SetPeriod(2 * period_));
+  EXPECT_EQ(activation.GetPeriod(), 2 * period_);
+}
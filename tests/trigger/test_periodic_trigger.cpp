@@ -53,3 +53,30 @@ TEST_F(PeriodicTriggerTest,
   EXPECT_CALL(*fakeActivation, Wait()).Times(0);
   trigger.CheckTriggerConditionAndWait();
 }
+
+TEST_F(PeriodicTriggerTest,
+       GetActivationStatus_Triggered_ReportsMissedCyclesAndJitter) {
+  EXPECT_CALL(*fakeCondition, IsTriggered()).WillOnce(testing::Return(true));
+  EXPECT_CALL(*fakeActivation, Wait()).WillOnce(testing::Return(2));
+  EXPECT_CALL(*fakeActivation, GetWakeUpJitter()).WillOnce(testing::Return(5us));
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+
+  const auto status = trigger.GetActivationStatus();
+  EXPECT_EQ(status.missed_cycles, 2);
+  EXPECT_EQ(status.wakeup_jitter, 5us);
+}
+
+TEST_F(PeriodicTriggerTest,
+       GetActivationStatus_NotTriggered_ReportsNothing) {
+  EXPECT_CALL(*fakeCondition, IsTriggered())
+      .WillOnce(testing::Return(true))
+      .WillOnce(testing::Return(false));
+  EXPECT_CALL(*fakeActivation, Wait()).WillOnce(testing::Return(1));
+  EXPECT_CALL(*fakeActivation, GetWakeUpJitter()).WillOnce(testing::Return(5us));
+  EXPECT_TRUE(trigger.CheckTriggerConditionAndWait());
+  EXPECT_FALSE(trigger.CheckTriggerConditionAndWait());
+
+  const auto status = trigger.GetActivationStatus();
+  EXPECT_EQ(status.missed_cycles, 0);
+  EXPECT_EQ(status.wakeup_jitter, 0ns);
+}
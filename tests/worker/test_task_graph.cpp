@@ -0,0 +1,207 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "daal/af/worker/task_graph.hpp"
+
+using daal::af::worker::TaskGraph;
+using daal::af::worker::WorkerPool;
+
+class TaskGraphTest : public ::testing::Test {
+ protected:
+  void Record(int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(value);
+  }
+
+  std::size_t PositionOf(int value) {
+    for (std::size_t idx = 0; idx < order.size(); ++idx) {
+      if (order[idx] == value) {
+        return idx;
+      }
+    }
+    return order.size();
+  }
+
+  WorkerPool pool{{0, 1}, 10};
+  std::mutex mutex;
+  std::vector<int> order;
+};
+
+TEST_F(TaskGraphTest, EmptyGraphSucceeds) {
+  TaskGraph graph{pool.Size()};
+  EXPECT_TRUE(graph.Finalize());
+  EXPECT_TRUE(graph.Execute(pool));
+}
+
+TEST_F(TaskGraphTest, DependenciesAreRespected) {
+  TaskGraph graph{pool.Size()};
+  // 0 -> {1, 2} -> 3
+  auto first = graph.AddNode([this]() {
+    Record(0);
+    return true;
+  });
+  auto left = graph.AddNode(
+      [this]() {
+        Record(1);
+        return true;
+      },
+      0);
+  auto right = graph.AddNode(
+      [this]() {
+        Record(2);
+        return true;
+      },
+      1);
+  auto last = graph.AddNode(
+      [this]() {
+        Record(3);
+        return true;
+      },
+      TaskGraph::kMainThread);
+  EXPECT_TRUE(graph.AddDependency(first, left));
+  EXPECT_TRUE(graph.AddDependency(first, right));
+  EXPECT_TRUE(graph.AddDependency(left, last));
+  EXPECT_TRUE(graph.AddDependency(right, last));
+  ASSERT_TRUE(graph.Finalize());
+
+  for (int cycle = 0; cycle < 20; ++cycle) {
+    order.clear();
+    EXPECT_TRUE(graph.Execute(pool));
+    ASSERT_EQ(order.size(), 4U);
+    EXPECT_EQ(order.front(), 0);
+    EXPECT_EQ(order.back(), 3);
+  }
+}
+
+TEST_F(TaskGraphTest, IndependentBranchDoesNotWaitForSlowNode) {
+  TaskGraph graph{pool.Size()};
+  // slow (worker 0) and fast -> after_fast are independent branches
+  graph.AddNode(
+      [this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        Record(0);
+        return true;
+      },
+      0);
+  auto fast = graph.AddNode(
+      [this]() {
+        Record(1);
+        return true;
+      },
+      1);
+  auto after_fast = graph.AddNode(
+      [this]() {
+        Record(2);
+        return true;
+      },
+      1);
+  EXPECT_TRUE(graph.AddDependency(fast, after_fast));
+  ASSERT_TRUE(graph.Finalize());
+
+  EXPECT_TRUE(graph.Execute(pool));
+  EXPECT_LT(PositionOf(2), PositionOf(0));
+}
+
+TEST_F(TaskGraphTest, TopologicalOrderIsDeterministic) {
+  TaskGraph graph{pool.Size()};
+  for (int idx = 0; idx < 4; ++idx) {
+    graph.AddNode([]() { return true; });
+  }
+  EXPECT_TRUE(graph.AddDependency(3, 0));
+  EXPECT_TRUE(graph.AddDependency(2, 1));
+  ASSERT_TRUE(graph.Finalize());
+
+  const std::vector<TaskGraph::NodeId> expected{2, 1, 3, 0};
+  EXPECT_EQ(graph.TopologicalOrder(), expected);
+}
+
+TEST_F(TaskGraphTest, CycleIsRejected) {
+  TaskGraph graph{pool.Size()};
+  auto first = graph.AddNode([]() { return true; });
+  auto second = graph.AddNode([]() { return true; });
+  EXPECT_TRUE(graph.AddDependency(first, second));
+  EXPECT_TRUE(graph.AddDependency(second, first));
+  EXPECT_FALSE(graph.Finalize());
+  EXPECT_FALSE(graph.IsFinalized());
+}
+
+TEST_F(TaskGraphTest, InvalidDependencyIsRejected) {
+  TaskGraph graph{pool.Size()};
+  auto node = graph.AddNode([]() { return true; });
+  EXPECT_FALSE(graph.AddDependency(node, node));
+  EXPECT_FALSE(graph.AddDependency(node, 7));
+}
+
+TEST_F(TaskGraphTest, InvalidWorkerIsRejected) {
+  TaskGraph graph{pool.Size()};
+  graph.AddNode([]() { return true; }, 2);
+  EXPECT_FALSE(graph.Finalize());
+}
+
+TEST_F(TaskGraphTest, FailureIsReportedAndAllNodesRun) {
+  std::atomic<int> counter{0};
+  TaskGraph graph{pool.Size()};
+  auto failing = graph.AddNode([]() { return false; });
+  auto next = graph.AddNode([&counter]() {
+    counter++;
+    return true;
+  });
+  EXPECT_TRUE(graph.AddDependency(failing, next));
+  ASSERT_TRUE(graph.Finalize());
+
+  EXPECT_FALSE(graph.Execute(pool));
+  EXPECT_EQ(counter.load(), 1);
+}
+
+TEST_F(TaskGraphTest, WideGraphIsExecutedRepeatedly) {
+  std::atomic<int> counter{0};
+  TaskGraph graph{pool.Size()};
+  auto root = graph.AddNode([]() { return true; }, TaskGraph::kMainThread);
+  for (int idx = 0; idx < 32; ++idx) {
+    auto node = graph.AddNode([&counter]() {
+      counter++;
+      return true;
+    });
+    EXPECT_TRUE(graph.AddDependency(root, node));
+  }
+  ASSERT_TRUE(graph.Finalize());
+
+  for (int cycle = 0; cycle < 50; ++cycle) {
+    EXPECT_TRUE(graph.Execute(pool));
+  }
+  EXPECT_EQ(counter.load(), 32 * 50);
+}
+
+TEST(TaskGraphWithoutWorkersTest, AnyNodesRunOnCallingThread) {
+  WorkerPool pool{{}, 10};
+  pthread_t caller = pthread_self();
+  pthread_t executor{};
+  TaskGraph graph{pool.Size()};
+  graph.AddNode([&executor]() {
+    executor = pthread_self();
+    return true;
+  });
+  ASSERT_TRUE(graph.Finalize());
+
+  EXPECT_TRUE(graph.Execute(pool));
+  EXPECT_TRUE(pthread_equal(executor, caller));
+}
@@ -0,0 +1,132 @@
+/********************************************************************************
+* Copyright (c) 2025 Contributors to the Eclipse Foundation
+*
+* See the NOTICE file(s) distributed with this work for additional
+* information regarding copyright ownership.
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "daal/af/worker/worker_pool.hpp"
+
+class WorkerPoolTest : public ::testing::Test {
+ protected:
+  daal::af::worker::WorkerPool pool{{0, 1}, 10};
+};
+
+TEST_F(WorkerPoolTest, SizeMatchesCores) { EXPECT_EQ(pool.Size(), 2U); }
+
+TEST_F(WorkerPoolTest, EmptyBatchSucceeds) {
+  auto batch = pool.CreateBatch();
+  pool.Fork(batch);
+  EXPECT_TRUE(pool.Join(batch));
+}
+
+TEST_F(WorkerPoolTest, AllStealableTasksAreExecutedOnce) {
+  std::atomic<int> counter{0};
+  auto batch = pool.CreateBatch();
+  for (int idx = 0; idx < 64; ++idx) {
+    batch.Add([&counter]() {
+      counter++;
+      return true;
+    });
+  }
+  EXPECT_EQ(batch.Size(), 64U);
+
+  pool.Fork(batch);
+  EXPECT_TRUE(pool.Join(batch));
+  EXPECT_EQ(counter.load(), 64);
+}
+
+TEST_F(WorkerPoolTest, BatchCanBeExecutedRepeatedly) {
+  std::atomic<int> counter{0};
+  auto batch = pool.CreateBatch();
+  for (int idx = 0; idx < 5; ++idx) {
+    batch.Add([&counter]() {
+      counter++;
+      return true;
+    });
+  }
+  for (int cycle = 0; cycle < 10; ++cycle) {
+    pool.Fork(batch);
+    EXPECT_TRUE(pool.Join(batch));
+  }
+  EXPECT_EQ(counter.load(), 50);
+}
+
+TEST_F(WorkerPoolTest, PinnedTasksRunOnTheirWorker) {
+  pthread_t caller = pthread_self();
+  pthread_t worker0{};
+  pthread_t worker1{};
+  auto batch = pool.CreateBatch();
+  batch.Add(
+      [&worker0]() {
+        worker0 = pthread_self();
+        return true;
+      },
+      0);
+  batch.Add(
+      [&worker1]() {
+        worker1 = pthread_self();
+        return true;
+      },
+      1);
+
+  pool.Fork(batch);
+  EXPECT_TRUE(pool.Join(batch));
+  EXPECT_FALSE(pthread_equal(worker0, caller));
+  EXPECT_FALSE(pthread_equal(worker1, caller));
+  EXPECT_FALSE(pthread_equal(worker0, worker1));
+}
+
+TEST_F(WorkerPoolTest, IdleWorkersStealFromBusyWorker) {
+  std::atomic<int> counter{0};
+  auto batch = pool.CreateBatch();
+  // Worker 0 is blocked by its pinned task, its lane has to be stolen
+  batch.Add(
+      []() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return true;
+      },
+      0);
+  for (int idx = 0; idx < 4; ++idx) {
+    batch.Add([&counter]() {
+      counter++;
+      return true;
+    });
+  }
+
+  pool.Fork(batch);
+  auto start = std::chrono::steady_clock::now();
+  while (counter.load() != 4 && std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50)) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(counter.load(), 4);
+  EXPECT_TRUE(pool.Join(batch));
+}
+
+TEST_F(WorkerPoolTest, FailureIsReported) {
+  auto batch = pool.CreateBatch();
+  batch.Add([]() { return true; });
+  batch.Add([]() { return false; });
+  batch.Add([]() { return true; }, 1);
+
+  pool.Fork(batch);
+  EXPECT_FALSE(pool.Join(batch));
+}
+
+TEST(WorkerPoolBatchTest, InvalidWorkerIndexShouldDie) {
+  daal::af::worker::WorkerPool::Batch batch{2};
+  EXPECT_DEATH(batch.Add([]() { return true; }, 2), "");
+}
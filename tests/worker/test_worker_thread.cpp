@@ -14,12 +14,14 @@
 #include <gtest/gtest.h>
 #include <pthread.h>
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <future>
 #include <queue>
 #include <thread>
-#include <chrono>
 
+#include "src/daal/af/sync/completion_latch.hpp"
 #include "src/daal/af/worker/worker_thread.hpp"
 
 class WorkerThreadTest : public ::testing::Test {
@@ -208,4 +210,74 @@ TEST_F(WorkerThreadTest, TrySubmitWithMultiplePromises) {
 
   EXPECT_EQ(future1.get(), true);
   EXPECT_EQ(future2.get(), false);
-}
\ No newline at end of file
+}
+
+namespace {
+bool IncrementCounter(void* context) {
+  static_cast<std::atomic<int>*>(context)->fetch_add(1);
+  return true;
+}
+
+bool FailTask(void*) { return false; }
+
+bool WaitForRelease(void* context) {
+  auto* release = static_cast<std::atomic<bool>*>(context);
+  while (!release->load()) {
+    std::this_thread::yield();
+  }
+  return true;
+}
+}  // namespace
+
+TEST_F(WorkerThreadTest, PostRejectsNullTask) {
+  EXPECT_FALSE(worker_thread->Post(nullptr, nullptr, nullptr));
+}
+
+TEST_F(WorkerThreadTest, PostCountsDownLatch) {
+  std::atomic<int> counter{0};
+  daal::af::sync::CompletionLatch latch;
+  latch.Reset(3);
+  EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+  EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+  EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+  EXPECT_TRUE(latch.Wait());
+  EXPECT_EQ(counter.load(), 3);
+}
+
+TEST_F(WorkerThreadTest, PostReportsFailureThroughLatch) {
+  std::atomic<int> counter{0};
+  daal::af::sync::CompletionLatch latch;
+  latch.Reset(2);
+  EXPECT_TRUE(worker_thread->Post(&FailTask, nullptr, &latch));
+  EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+  EXPECT_FALSE(latch.Wait());
+  EXPECT_EQ(counter.load(), 1);
+}
+
+TEST_F(WorkerThreadTest, PostFailsIfRingIsFull) {
+  std::atomic<bool> release{false};
+  std::atomic<int> counter{0};
+  daal::af::sync::CompletionLatch latch;
+  latch.Reset(daal::af::worker::WorkerThread::kRingCapacity);
+  EXPECT_TRUE(worker_thread->Post(&WaitForRelease, &release, &latch));
+  for (std::uint32_t idx = 1; idx < daal::af::worker::WorkerThread::kRingCapacity; ++idx) {
+    EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+  }
+  EXPECT_FALSE(worker_thread->Post(&IncrementCounter, &counter, nullptr));
+  EXPECT_FALSE(worker_thread->IsIdle());
+
+  release.store(true);
+  EXPECT_TRUE(latch.Wait());
+  EXPECT_EQ(counter.load(), static_cast<int>(daal::af::worker::WorkerThread::kRingCapacity) - 1);
+}
+
+TEST_F(WorkerThreadTest, LatchCanBeReused) {
+  std::atomic<int> counter{0};
+  daal::af::sync::CompletionLatch latch;
+  for (int round = 0; round < 100; ++round) {
+    latch.Reset(1);
+    EXPECT_TRUE(worker_thread->Post(&IncrementCounter, &counter, &latch));
+    EXPECT_TRUE(latch.Wait());
+  }
+  EXPECT_EQ(counter.load(), 100);
+}